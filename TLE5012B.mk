@@ -17,6 +17,7 @@ GLOBAL_INCLUDES  := src/config \
 
 $(NAME)_SOURCES  := src/corelib/TLE5012b.cpp \
 					src/corelib/tle5012b_reg.cpp \
+					src/corelib/tle5012b_crc.cpp \
 					src/pal/gpio.cpp \
 					src/pal/spic.cpp \
 					src/framework/wiced-43xxx/pal/timer-wiced.cpp \
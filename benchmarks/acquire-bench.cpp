@@ -0,0 +1,143 @@
+/**
+ * @file        acquire-bench.cpp
+ * @brief       Shaft twist from two sensors, live reads against a coherent snapshot
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Two simulated sensors on one bus clock see the same shaft at 6000 rpm,
+ * the second one turned by a fixed twist. The twist is measured from live
+ * reads of one sensor after the other and from Tle5012bBus::acquire, which
+ * triggers both update buffers and reads them with UPD_high. Prints the
+ * twist errors and the trigger skew. Checks that the skew is the time of one
+ * held trigger, also through SPICStats, that the snapshot error stays
+ * within the update periods of the two free running sensors plus the skew,
+ * that the live error is larger and that a failed safety word is reported.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "bench.hpp"
+#include "pal/spic-stats.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_ROUNDS     500
+#define SPEED_DEG      36000.0       /**< 6000 rpm */
+#define TWIST_DEG      2.5
+#define SPI_CLOCK      1000000       /**< SPEED of SPIClass3W */
+#define SETUP_NS       2000          /**< assumed beginTransaction and MISO setup */
+#define PIN_NS         1500          /**< assumed pinMode */
+#define TURN_NS        5000          /**< SPI3W_TURNAROUND_US of SPIClass3W */
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+static double wrap(double angle)
+{
+	angle = fmod(angle, 360.0);
+	return ((angle > 180.0) ? angle - 360.0 : ((angle < -180.0) ? angle + 360.0 : angle));
+}
+
+static double twistError(Tle5012b::motionSnapshot &a, Tle5012b::motionSnapshot &b)
+{
+	return (fabs(wrap((b.angleQ16() - a.angleQ16()) * (360.0 / 65536.0) - TWIST_DEG)));
+}
+
+int main()
+{
+	int failed = 0;
+	Tle5012Host s0(Tle5012b::TLE5012B_S0), s1(Tle5012b::TLE5012B_S1);
+	s1.sim.shareClock(s0.sim);
+	Tle5012Host *sensors[2] = { &s0, &s1 };
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		sensors[i]->sim.spiClock = SPI_CLOCK;
+		sensors[i]->bus.setupTime = SETUP_NS;
+		sensors[i]->bus.pinTime = PIN_NS;
+		sensors[i]->bus.turnTime = TURN_NS;
+		sensors[i]->sim.setTrajectory(30.0 + TWIST_DEG * i, SPEED_DEG, 0.0);
+		CHECK(sensors[i]->begin() == NO_ERROR);
+	}
+	TimerHost timer(&s0.sim);
+	timer.init();
+	Tle5012bBus bus(timer);
+	CHECK(bus.addSensor(s0, 0) == 0);
+	CHECK(bus.addSensor(s1, 0) == 1);
+	uint64_t origin = s0.sim.now();
+	bus.begin();
+
+	// live reads, one sensor after the other
+	double liveMax = 0.0, liveSum = 0.0;
+	for (uint16_t r = 0; r < NUM_ROUNDS; r++)
+	{
+		Tle5012b::motionSnapshot a, b;
+		CHECK(s0.readMotionSnapshot(a) == NO_ERROR);
+		CHECK(s1.readMotionSnapshot(b) == NO_ERROR);
+		double error = twistError(a, b);
+		liveMax = (error > liveMax) ? error : liveMax;
+		liveSum += error;
+		timer.delayMicro(997);
+	}
+
+	// snapshots of the same instant
+	double snapMax = 0.0, snapSum = 0.0, traceMax = 0.0;
+	for (uint16_t r = 0; r < NUM_ROUNDS; r++)
+	{
+		Tle5012bBus::sample samples[2];
+		uint32_t skew = 0;
+		CHECK(bus.acquire(samples, skew) == NO_ERROR);
+		CHECK(samples[0].index == r);
+		double error = twistError(samples[0].motion, samples[1].motion);
+		snapMax = (error > snapMax) ? error : snapMax;
+		snapSum += error;
+		for (uint8_t i = 0; i < 2; i++)
+		{
+			// the value is from the last update period before the trigger
+			double expected = sensors[i]->sim.angleAt((origin + (uint64_t) samples[i].time * 1000) / 1e9);
+			double trace = fabs(wrap(samples[i].motion.angleQ16() * (360.0 / 65536.0) - expected));
+			traceMax = (trace > traceMax) ? trace : traceMax;
+		}
+		timer.delayMicro(997);
+	}
+	double period = s0.sim.updatePeriod() / 1e9;
+	double bound = SPEED_DEG * (period + (bus.maxSkew + 1) / 1e6) + 0.02;
+	printf("%-10s %12s %12s\n", "twist", "max deg", "mean deg");
+	printf("%-10s %12.3f %12.3f\n", "live", liveMax, liveSum / NUM_ROUNDS);
+	printf("%-10s %12.3f %12.3f\n", "snapshot", snapMax, snapSum / NUM_ROUNDS);
+	printf("max trigger skew %u us, update period %.1f us, bound %.3f deg\n", bus.maxSkew, period * 1e6, bound);
+	// the second trigger starts after the pins and the CSQ edge of the first one
+	uint32_t heldNs = PIN_NS + s0.sim.csTime;
+	CHECK((bus.maxSkew >= heldNs / 1000) && (bus.maxSkew <= (heldNs + 999) / 1000));
+	CHECK(snapMax < bound);
+	CHECK(traceMax < bound);
+	CHECK(snapSum < liveSum / 4);
+	CHECK(liveMax > snapMax);
+	CHECK(bus.stats[0].samples == NUM_ROUNDS);
+
+	// the instrumentation holds the triggers too, a whole trigger would add the grace period
+	uint32_t heldSkew = bus.maxSkew;
+	SPICStats stats0(&s0.bus), stats1(&s1.bus);
+	s0.sBus = &stats0;
+	s1.sBus = &stats1;
+	bus.resetStats();
+	for (uint8_t r = 0; r < 10; r++)
+	{
+		Tle5012bBus::sample samples[2];
+		uint32_t skew = 0;
+		CHECK(bus.acquire(samples, skew) == NO_ERROR);
+	}
+	CHECK(bus.maxSkew == heldSkew);
+	CHECK((stats0.updates.transfers == 10) && (stats1.updates.transfers == 10));
+	s0.sBus = &s0.bus;
+	s1.sBus = &s1.bus;
+
+	// a failed safety word of one sensor is returned, the other sample is valid
+	Tle5012bBus::sample samples[2];
+	uint32_t skew = 0;
+	s1.sim.injectCrcError(1);
+	CHECK(bus.acquire(samples, skew) == CRC_ERROR);
+	CHECK(samples[0].status == NO_ERROR);
+	CHECK(samples[1].status == CRC_ERROR);
+	CHECK(bus.stats[1].errors == 1);
+
+	return (failed == 0 ? 0 : 1);
+}
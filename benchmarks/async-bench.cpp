@@ -0,0 +1,190 @@
+/**
+ * @file        async-bench.cpp
+ * @brief       Control loop throughput with blocking and with pipelined reads
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Runs a control loop with about 100 us of computation per cycle against the
+ * simulated sensor at the 1 MHz SSC clock, with the transfers taking their
+ * model time on the wall clock. The blocking loop reads the motion registers
+ * and then computes, the pipelined loop submits the read of the next cycle to
+ * the request queue and computes while the worker thread of the host bus does
+ * the transfer. Prints the cycles per second of both. Checks that the
+ * asynchronous reads return the same values as the blocking ones, that a
+ * full queue is rejected, that a too small buffer keeps the read, that the
+ * reads complete at once on a bus without a worker and that SPICStats and
+ * SPICTrace pass the reads on to the worker.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include <thread>
+#include "bench.hpp"
+#include "pal/spic-stats.hpp"
+#include "pal/spic-trace.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_CYCLES     500
+#define COMPUTE_US     100           /**< computation per control cycle */
+#define SPI_CLOCK      1000000       /**< SPEED of SPIClass3W */
+#define SETUP_NS       2000          /**< assumed beginTransaction and MISO setup */
+#define PIN_NS         1500          /**< assumed pinMode */
+#define TURN_NS        5000          /**< SPI3W_TURNAROUND_US of SPIClass3W */
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Stands for the control math, spins COMPUTE_US on the wall clock
+ */
+static double compute(int32_t angleQ16)
+{
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::microseconds(COMPUTE_US);
+	double out = 0.0;
+	do
+	{
+		out += sin(angleQ16 * (2.0 * M_PI / 65536.0));
+	} while (std::chrono::steady_clock::now() < end);
+	return (out);
+}
+
+static void countSink(const uint8_t *data, uint16_t length, void *context)
+{
+	(void) data;
+	*(uint32_t *) context += length;
+}
+
+static double elapsed(std::chrono::steady_clock::time_point start)
+{
+	return (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+}
+
+int main()
+{
+	int failed = 0;
+	volatile double sink = 0.0;
+	Tle5012Host sensor;
+	sensor.begin();
+	sensor.sim.spiClock = SPI_CLOCK;
+	sensor.sim.setTrajectory(123.0, 0.0, 0.0);
+	sensor.bus.setupTime = SETUP_NS;
+	sensor.bus.pinTime = PIN_NS;
+	sensor.bus.turnTime = TURN_NS;
+	SPICQueue queue(&sensor.bus);
+	Tle5012Async async(sensor, queue);
+
+	// reference values of the blocking reads
+	Tle5012b::motionSnapshot reference;
+	int32_t referenceQ16 = 0;
+	CHECK(sensor.readMotionSnapshot(reference) == NO_ERROR);
+	CHECK(sensor.getAngleQ16(referenceQ16) == NO_ERROR);
+
+	// on a bus without a worker the default adapter completes at once
+	Tle5012Async::token_t token = async.getAngleAsync();
+	CHECK(token != ASYNC_NO_TOKEN);
+	CHECK(async.isDone(token));
+	CHECK(queue.pending() == 0);
+	int32_t angleQ16 = 0;
+	CHECK(async.takeAngleQ16(token, angleQ16) == NO_ERROR);
+	CHECK(angleQ16 == referenceQ16);
+	CHECK(async.takeAngleQ16(token, angleQ16) == INTERFACE_ACCESS_ERROR);
+	CHECK(async.takeAngleQ16(ASYNC_NO_TOKEN, angleQ16) == INTERFACE_ACCESS_ERROR);
+	// a too small buffer keeps the read, it can be taken again with a larger one
+	token = async.getMotionAsync();
+	uint16_t words[MOTION_NUM_REGISTERS];
+	CHECK(async.takeData(token, words, MOTION_NUM_REGISTERS - 1) == BUFFER_SIZE_ERROR);
+	CHECK(async.takeData(token, words, MOTION_NUM_REGISTERS) == NO_ERROR);
+	CHECK(async.takeData(token, words, MOTION_NUM_REGISTERS) == INTERFACE_ACCESS_ERROR);
+
+	sensor.bus.realTime = true;
+	sensor.bus.startWorker();
+
+	// blocking: read, then compute
+	uint32_t errors = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (uint16_t c = 0; c < NUM_CYCLES; c++)
+	{
+		Tle5012b::motionSnapshot snapshot;
+		errors += (sensor.readMotionSnapshot(snapshot) != NO_ERROR);
+		sink = sink + compute(snapshot.angleQ16());
+	}
+	double blocking = NUM_CYCLES / elapsed(start);
+
+	// pipelined: take the read of this cycle, submit the next one, compute
+	uint32_t mismatches = 0;
+	start = std::chrono::steady_clock::now();
+	token = async.getMotionAsync();
+	for (uint16_t c = 0; c < NUM_CYCLES; c++)
+	{
+		Tle5012b::motionSnapshot snapshot;
+		errors += (async.takeMotion(token, snapshot) != NO_ERROR);
+		mismatches += (snapshot.rawAngle != reference.rawAngle) || (snapshot.revolutions != reference.revolutions);
+		token = async.getMotionAsync();
+		sink = sink + compute(snapshot.angleQ16());
+	}
+	double pipelined = NUM_CYCLES / elapsed(start);
+	Tle5012b::motionSnapshot last;
+	errors += (async.takeMotion(token, last) != NO_ERROR);
+	CHECK(errors == 0);
+	CHECK(mismatches == 0);
+
+	unsigned cores = std::thread::hardware_concurrency();
+	printf("%-12s %12s %12s %10s %6s\n", "loop", "cycles/s", "us/cycle", "speedup", "cores");
+	printf("%-12s %12.0f %12.1f %10s %6u\n", "blocking", blocking, 1e6 / blocking, "", cores);
+	printf("%-12s %12.0f %12.1f %10.2f %6u\n", "pipelined", pipelined, 1e6 / pipelined, pipelined / blocking, cores);
+	if (cores >= 2)
+	{
+		CHECK(pipelined > 1.2 * blocking);
+	}
+
+	// a full queue: all tokens are in use and submit rejects the request
+	sensor.bus.setupTime = 10000000;
+	Tle5012Async::token_t tokens[TLE5012_SPIC_QUEUE_DEPTH];
+	for (uint8_t i = 0; i < TLE5012_SPIC_QUEUE_DEPTH; i++)
+	{
+		tokens[i] = async.getAngleAsync();
+		CHECK(tokens[i] != ASYNC_NO_TOKEN);
+	}
+	CHECK(async.getAngleAsync() == ASYNC_NO_TOKEN);
+	CHECK(!async.isDone(tokens[TLE5012_SPIC_QUEUE_DEPTH - 1]));
+	uint16_t command = READ_SENSOR | sensor.reg.REG_AVAL;
+	uint16_t data[2];
+	SPIC::Command_t extra = { &command, 1, data, 2, NULL };
+	SPICQueue::Request_t request = { &extra, 1 };
+	uint32_t rejected = queue.rejected;
+	CHECK(queue.submit(request, NULL) == SPIC::INTF_ERROR);
+	CHECK(queue.rejected == rejected + 1);
+	sensor.bus.setupTime = SETUP_NS;
+	for (uint8_t i = 0; i < TLE5012_SPIC_QUEUE_DEPTH; i++)
+	{
+		CHECK(async.takeAngleQ16(tokens[i], angleQ16) == NO_ERROR);
+		CHECK(angleQ16 == referenceQ16);
+	}
+
+	// a failed safety word is reported by the take
+	queue.flush();
+	sensor.sim.injectCrcError(1);
+	token = async.getAngleAsync();
+	CHECK(async.takeAngleQ16(token, angleQ16) == CRC_ERROR);
+	token = async.getAngleAsync();
+	CHECK(async.takeAngleQ16(token, angleQ16) == NO_ERROR);
+
+	// the instrumentation runs on the worker too and counts the read when it is done
+	queue.flush();
+	uint32_t traced = 0;
+	SPICTrace trace(&sensor.bus, 0, countSink, &traced);
+	SPICStats stats(&trace);
+	SPICQueue wrapped(&stats);
+	Tle5012Async wrappedAsync(sensor, wrapped);
+	sensor.bus.setupTime = 10000000;
+	token = wrappedAsync.getMotionAsync();
+	CHECK(stats.isBusy());
+	CHECK(wrappedAsync.takeMotion(token, last) == NO_ERROR);
+	CHECK(last.rawAngle == reference.rawAngle);
+	CHECK(stats.registerStats(0x02).transfers == 1);
+	CHECK(traced == SPIC_TRACE_RECORD_SIZE + 2 * (MOTION_NUM_REGISTERS + 2));
+	sensor.bus.setupTime = SETUP_NS;
+
+	sensor.bus.stopWorker();
+	return (failed == 0 ? 0 : 1);
+}
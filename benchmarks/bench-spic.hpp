@@ -0,0 +1,90 @@
+/**
+ * @file        bench-spic.hpp
+ * @brief       Minimal register file SPIC for the TLE5012B host benchmarks
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Answers read and write commands from a plain register file with a valid
+ * safety word and counts the 16 bit words moved over the bus, so the
+ * benchmarks can compare bus traffic without a sensor.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef BENCH_SPIC_HPP_
+#define BENCH_SPIC_HPP_
+
+#include <string.h>
+#include "corelib/TLE5012b.hpp"
+
+class BenchSPIC: virtual public SPIC
+{
+	public:
+
+		uint16_t regs[64];           //!< \brief register file by 6 bit address
+		uint32_t words;              //!< \brief 16 bit words on the bus
+		uint32_t transfers;          //!< \brief chip select cycles
+		uint16_t failWrite;          //!< \brief corrupts the safety word of the n-th next write, 0 for none
+
+		BenchSPIC(): words(0), transfers(0), failWrite(0)
+		{
+			for (uint16_t i = 0; i < 64; i++)
+			{
+				regs[i] = (uint16_t) (0x1000 + i);
+			}
+		}
+
+		Error_t init()
+		{
+			return OK;
+		}
+
+		Error_t deinit()
+		{
+			return OK;
+		}
+
+		Error_t triggerUpdate()
+		{
+			return OK;
+		}
+
+		Error_t sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+		{
+			uint16_t command = sent_data[0];
+			uint16_t addr = (command >> 4) & 0x3F;
+			uint16_t length = command & 0x000F;
+
+			transfers++;
+			words += size_of_sent_data + size_of_received_data;
+			if (command & 0x8000)
+			{
+				for (uint16_t i = 0; i < length && i < size_of_received_data; i++)
+				{
+					received_data[i] = regs[(addr + i) & 0x3F];
+				}
+				if (size_of_received_data > length)
+				{
+					received_data[length] = safety(command, received_data, length);
+				}
+			}else{
+				regs[addr] = sent_data[1];
+				received_data[0] = safety(command, &sent_data[1], 1);
+				// the write reaches the register file, only its answer is broken
+				if ((failWrite != 0) && (--failWrite == 0))
+				{
+					received_data[0] ^= 0x0001;
+				}
+			}
+			return OK;
+		}
+
+	private:
+
+		uint16_t safety(uint16_t command, const uint16_t *data, uint16_t length)
+		{
+			return ((uint16_t) (0x7E00 | crc8Words(command, data, length)));
+		}
+};
+
+#endif /** BENCH_SPIC_HPP_ **/
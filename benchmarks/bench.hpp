@@ -0,0 +1,63 @@
+/**
+ * @file        bench.hpp
+ * @brief       Helpers for the TLE5012B host benchmarks
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef BENCH_HPP_
+#define BENCH_HPP_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_CYCLES    1
+#else
+#define BENCH_HAS_CYCLES    0
+#endif
+
+/**
+ * @brief Reads the CPU time stamp counter, or the monotonic clock in
+ * nanoseconds on hosts without one.
+ *
+ * @return uint64_t cycles or nanoseconds
+ */
+static inline uint64_t benchCycles()
+{
+#if BENCH_HAS_CYCLES
+	return __rdtsc();
+#else
+	return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/**
+ * @brief Unit of benchCycles()
+ */
+static inline const char *benchCycleUnit()
+{
+	return (BENCH_HAS_CYCLES ? "cycles" : "ns");
+}
+
+/**
+ * @brief Monotonic clock in nanoseconds
+ */
+static inline uint64_t benchNanos()
+{
+	return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Keeps the compiler from optimizing a result away
+ */
+template<typename T> static inline void benchKeep(T const &value)
+{
+	__asm__ __volatile__("" : : "g"(value) : "memory");
+}
+
+#endif /** BENCH_HPP_ **/
@@ -0,0 +1,208 @@
+/**
+ * @file        bus-bench.cpp
+ * @brief       Four sensors on one bus with the round-robin scheduler
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Puts four simulated sensors S0 to S3 with different magnet speeds on one
+ * bus clock and reads them with Tle5012bBus at different rates for one
+ * second of model time. Prints the samples, the bus utilization and the bus
+ * time per sample against the hand loop of useMultipleSensors, which reads
+ * the angle and the revolutions one after the other. Checks the sample
+ * counts and timestamps, the angles against the trajectories, the errors of
+ * a failed safety word and that an overloaded bus serves all sensors alike.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "bench.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_SENSORS    4
+#define RUN_US         1000000
+#define SPI_CLOCK      1000000       /**< SPEED of SPIClass3W */
+#define SETUP_NS       2000          /**< assumed beginTransaction and MISO setup */
+#define PIN_NS         1500          /**< assumed pinMode */
+#define TURN_NS        5000          /**< SPI3W_TURNAROUND_US of SPIClass3W */
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief What the callback checks of the samples
+ */
+struct checkContext
+{
+	Tle5012Host **sensors;
+	uint64_t     begin;                       //!< \brief model time of Tle5012bBus::begin in ns
+	uint32_t     period[NUM_SENSORS];
+	uint32_t     lastTime[NUM_SENSORS];
+	uint32_t     lastIndex[NUM_SENSORS];
+	uint32_t     gridErrors;                  //!< \brief samples off their period grid
+	double       maxAngleError;               //!< \brief in degree
+	bool         checkAngles;
+};
+
+static void onSample(const Tle5012bBus::sample &s, void *context)
+{
+	checkContext *c = (checkContext *) context;
+	if (s.index > 0)
+	{
+		// a sample is not earlier than its grid time and not later than the next one
+		uint32_t grid = s.index * c->period[s.sensor];
+		c->gridErrors += (s.time < grid) || (s.time >= grid + c->period[s.sensor]) || (s.index <= c->lastIndex[s.sensor])
+			|| (s.time <= c->lastTime[s.sensor]);
+	}
+	c->lastTime[s.sensor] = s.time;
+	c->lastIndex[s.sensor] = s.index;
+	if (c->checkAngles && (s.status == NO_ERROR))
+	{
+		Tle5012Sim &sim = c->sensors[s.sensor]->sim;
+		double expected = sim.angleAt((c->begin + (uint64_t) s.time * 1000) / 1e9);
+		Tle5012b::motionSnapshot motion = s.motion;
+		double error = fmod(motion.angleQ16() * (360.0 / 65536.0) - expected, 360.0);
+		error = (error > 180.0) ? error - 360.0 : ((error < -180.0) ? error + 360.0 : error);
+		c->maxAngleError = (fabs(error) > c->maxAngleError) ? fabs(error) : c->maxAngleError;
+	}
+}
+
+int main()
+{
+	int failed = 0;
+	Tle5012Host s0(Tle5012b::TLE5012B_S0), s1(Tle5012b::TLE5012B_S1), s2(Tle5012b::TLE5012B_S2), s3(Tle5012b::TLE5012B_S3);
+	Tle5012Host *sensors[NUM_SENSORS] = { &s0, &s1, &s2, &s3 };
+	uint32_t periods[NUM_SENSORS] = { 1000, 1000, 2000, 5000 };
+	for (uint8_t i = 0; i < NUM_SENSORS; i++)
+	{
+		if (i > 0)
+		{
+			sensors[i]->sim.shareClock(sensors[0]->sim);
+		}
+		sensors[i]->sim.spiClock = SPI_CLOCK;
+		sensors[i]->bus.setupTime = SETUP_NS;
+		sensors[i]->bus.pinTime = PIN_NS;
+		sensors[i]->bus.turnTime = TURN_NS;
+		sensors[i]->sim.setTrajectory(10.0 + 80.0 * i, 360.0 * (i + 1), 0.0);
+		CHECK(sensors[i]->begin() == NO_ERROR);
+	}
+
+	TimerHost timer(&sensors[0]->sim);
+	timer.init();
+	Tle5012bBus bus(timer);
+	checkContext context;
+	memset(&context, 0, sizeof(context));
+	context.sensors = sensors;
+	context.checkAngles = true;
+	for (uint8_t i = 0; i < NUM_SENSORS; i++)
+	{
+		CHECK(bus.addSensor(*sensors[i], periods[i]) == i);
+		context.period[i] = periods[i];
+	}
+	CHECK(bus.addSensor(*sensors[0], 1000) == BUS_NO_SENSOR);
+	bus.setCallback(onSample, &context);
+
+	uint64_t words = 0;
+	for (uint8_t i = 0; i < NUM_SENSORS; i++)
+	{
+		words -= sensors[i]->sim.words;
+	}
+	context.begin = sensors[0]->sim.now();
+	bus.begin();
+	uint32_t elapsed = 0;
+	while (elapsed < RUN_US)
+	{
+		bus.next();
+		timer.elapsedMicro(elapsed);
+	}
+	uint16_t utilization = bus.utilization();
+	uint32_t samples = 0;
+	for (uint8_t i = 0; i < NUM_SENSORS; i++)
+	{
+		words += sensors[i]->sim.words;
+		samples += bus.stats[i].samples;
+	}
+	double busPerSample = (double) utilization / 1000.0 * elapsed / samples;
+
+	printf("%-8s %10s %10s %8s %8s\n", "sensor", "period us", "samples", "missed", "errors");
+	for (uint8_t i = 0; i < NUM_SENSORS; i++)
+	{
+		printf("S%-7u %10u %10u %8u %8u\n", i, periods[i], bus.stats[i].samples, bus.stats[i].missed, bus.stats[i].errors);
+		CHECK(bus.stats[i].missed == 0);
+		CHECK(bus.stats[i].errors == 0);
+		uint32_t expected = (elapsed + periods[i] - 1) / periods[i];
+		CHECK((bus.stats[i].samples >= expected) && (bus.stats[i].samples <= expected + 1));
+	}
+	CHECK(context.gridErrors == 0);
+	CHECK(context.maxAngleError < 0.5);
+	CHECK(words == (uint64_t) samples * (MOTION_NUM_REGISTERS + 2));
+
+	// the hand loop of useMultipleSensors, angle and revolutions in two reads
+	uint64_t start = sensors[0]->sim.now();
+	for (uint8_t i = 0; i < NUM_SENSORS; i++)
+	{
+		double angle = 0.0;
+		int16_t revolutions = 0;
+		CHECK(sensors[i]->getAngleValue(angle) == NO_ERROR);
+		CHECK(sensors[i]->getNumRevolutions(revolutions) == NO_ERROR);
+	}
+	double handPerSample = (sensors[0]->sim.now() - start) / 1000.0 / NUM_SENSORS;
+	printf("utilization %.1f %%, max angle error %.3f deg, bus us per sample %.1f, hand loop %.1f\n",
+		utilization / 10.0, context.maxAngleError, busPerSample, handPerSample);
+	CHECK(busPerSample < handPerSample);
+	uint32_t busy = 0;
+	for (uint8_t i = 0; i < NUM_SENSORS; i++)
+	{
+		busy += 1000000 / periods[i];
+	}
+	// the model time of the reads gives the utilization
+	CHECK(fabs(utilization - busPerSample * busy / 1000.0) <= 2.0);
+
+	// a failed safety word counts as error of its sensor
+	bus.resetStats();
+	context.checkAngles = false;
+	sensors[2]->sim.injectCrcError(1);
+	while (bus.stats[2].samples < 2)
+	{
+		bus.next();
+	}
+	CHECK(bus.stats[2].errors == 1);
+	CHECK(bus.stats[0].errors == 0);
+
+	// an overloaded bus: all sensors get the same share, the rest is missed
+	for (uint8_t i = 0; i < NUM_SENSORS; i++)
+	{
+		bus.setRate(i, 50);
+		context.period[i] = 50;
+	}
+	bus.begin();
+	memset(context.lastTime, 0, sizeof(context.lastTime));
+	memset(context.lastIndex, 0, sizeof(context.lastIndex));
+	context.gridErrors = 0;
+	for (uint16_t r = 0; r < 1000; r++)
+	{
+		bus.next();
+	}
+	utilization = bus.utilization();
+	uint32_t low = bus.stats[0].samples, high = bus.stats[0].samples;
+	for (uint8_t i = 1; i < NUM_SENSORS; i++)
+	{
+		low = (bus.stats[i].samples < low) ? bus.stats[i].samples : low;
+		high = (bus.stats[i].samples > high) ? bus.stats[i].samples : high;
+	}
+	printf("overload 50 us: utilization %.1f %%, samples %u - %u, missed S0 %u\n", utilization / 10.0, low, high, bus.stats[0].missed);
+	CHECK(utilization >= 990);
+	CHECK(high - low <= 1);
+	CHECK(bus.stats[0].missed > 0);
+	CHECK(context.gridErrors == 0);
+
+	// a paused sensor is not read
+	bus.setRate(3, 0);
+	uint32_t paused = bus.stats[3].samples;
+	for (uint16_t r = 0; r < 100; r++)
+	{
+		bus.next();
+	}
+	CHECK(bus.stats[3].samples == paused);
+
+	return (failed == 0 ? 0 : 1);
+}
@@ -0,0 +1,102 @@
+/**
+ * @file        cache-bench.cpp
+ * @brief       Bus traffic of the Reg bit field getters with the register cache
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Queries a typical set of configuration bit fields repeatedly and prints
+ * the chip select cycles and cache hits. Checks that the cached values
+ * follow the register file, that a write invalidates the written register
+ * and that volatile registers are always read.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.hpp"
+#include "bench-spic.hpp"
+
+#define NUM_ROUNDS    1000
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+int main()
+{
+	BenchSPIC bus;
+	Tle5012b sensor;
+	int failed = 0;
+	uint32_t sum = 0;
+
+	sensor.sBus = &bus;
+	bus.regs[0x08] = 0x0804;                 // MOD_2 prediction on, angle range 0x080, no autocal
+	bus.regs[0x0D] = 0x0002;                 // IFAB hysteresis 2
+	bus.regs[0x0E] = 0x01A1;                 // MOD_4 PWM, HSMPLP 0xD
+
+	uint64_t start = benchNanos();
+	for (uint16_t r = 0; r < NUM_ROUNDS; r++)
+	{
+		sum += sensor.reg.getHysteresisMode();
+		sum += sensor.reg.getHSMplp();
+		sum += sensor.reg.getInterfaceMode();
+		sum += sensor.reg.isPrediction();
+		sum += sensor.reg.getAngleRange();
+		sum += sensor.reg.getFilterDecimation();
+	}
+	uint64_t ns = benchNanos() - start;
+	benchKeep(sum);
+	printf("%u config bit field reads: %u transfers, %u hits, %u misses, %.1f ns per read\n",
+		6 * NUM_ROUNDS, bus.transfers, sensor.reg.cacheHits, sensor.reg.cacheMisses, (double) ns / (6 * NUM_ROUNDS));
+	CHECK(bus.transfers == 4);
+	CHECK(sensor.reg.getHysteresisMode() == 2);
+	CHECK(sensor.reg.getInterfaceMode() == Reg::PWM);
+	CHECK(sensor.reg.isPrediction());
+
+	// a write invalidates the register
+	bus.transfers = 0;
+	sensor.reg.setHysteresisMode(1);
+	uint32_t writeTransfers = bus.transfers;
+	CHECK(sensor.reg.getHysteresisMode() == 1);
+	CHECK(bus.transfers == writeTransfers + 1);
+	CHECK(sensor.reg.getHysteresisMode() == 1);
+	CHECK(bus.transfers == writeTransfers + 1);
+
+	// volatile registers are always read
+	bus.transfers = 0;
+	bus.regs[0x02] = 0x8123;
+	CHECK(sensor.reg.getAngleValue() == 0x0123);
+	bus.regs[0x02] = 0x8456;
+	CHECK(sensor.reg.getAngleValue() == 0x0456);
+	CHECK(bus.transfers == 2);
+
+	// a firmware reset invalidates all registers
+	bus.regs[0x0E] = 0x0000;
+	sensor.resetFirmware();
+	CHECK(sensor.reg.getInterfaceMode() == Reg::IIF);
+
+	// offsets are not cached while auto-calibration is on
+	bus.regs[0x0A] = 0x1230;
+	sensor.reg.isPrediction();
+	CHECK(sensor.reg.getOffsetX() == 0x123);
+	bus.transfers = 0;
+	sensor.reg.getOffsetX();
+	CHECK(bus.transfers == 0);
+	bus.regs[0x08] |= Reg::mode1;
+	sensor.reg.invalidateCache(Reg::MASK_MOD_2);
+	sensor.reg.isPrediction();
+	bus.transfers = 0;
+	sensor.reg.getOffsetX();
+	CHECK(bus.transfers == 1);
+
+	// planned reads fill the cache
+	sensor.reg.invalidateCache();
+	sensor.readRegisters(Reg::MASK_MOD_1 | Reg::MASK_MOD_4);
+	bus.transfers = 0;
+	sensor.reg.getFilterDecimation();
+	sensor.reg.getIFABres();
+	CHECK(bus.transfers == 0);
+
+	if (failed != 0)
+	{
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,196 @@
+/**
+ * @file        crc-bench.cpp
+ * @brief       Compares the CRC8 implementations of the safety word check
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Every safe transfer of the TLE5012B is checked with a CRC8 over the command
+ * word and all data words. This benchmark checks that all implementations
+ * give the same result as the original bit by bit loop and prints the time
+ * spent per verified 16 bit word for the typical transfer lengths.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdlib.h>
+#include "bench.hpp"
+#include "corelib/tle5012b_crc.hpp"
+
+#define NUM_TRANSFERS    1024
+#define NUM_ROUNDS       200
+
+/**
+ * @brief the original implementation, used as reference
+ */
+static uint8_t crc8Reference(uint8_t *data, uint8_t length)
+{
+	uint32_t crc = CRC_SEED;
+	for (int16_t i = 0; i < length; i++)
+	{
+		crc ^= data[i];
+		for (int16_t bit = 0; bit < 8; bit++)
+		{
+			if ((crc & 0x80) != 0)
+			{
+				crc <<= 1;
+				crc ^= CRC_POLYNOMIAL;
+			}else{
+				crc <<= 1;
+			}
+		}
+	}
+	return ((~crc) & CRC_SEED);
+}
+
+/**
+ * @brief word by word with the CRC context, as folded in while receiving
+ */
+static uint8_t crc8Stream(uint16_t command, const uint16_t *data, uint16_t length)
+{
+	crc8Ctx_t ctx;
+	crcInit(ctx, command);
+	for (uint16_t i = 0; i < length; i++)
+	{
+		crcUpdateWord(ctx, data[i]);
+	}
+	return (crcFinal(ctx));
+}
+
+typedef uint8_t (*crcBytes_t)(const uint8_t *data, uint8_t length);
+typedef uint8_t (*crcWords_t)(uint16_t command, const uint16_t *data, uint16_t length);
+
+static uint16_t commands[NUM_TRANSFERS];
+static uint16_t words[NUM_TRANSFERS][MAX_NUM_REG];
+static uint8_t  bytes[NUM_TRANSFERS][2 * MAX_NUM_REG + 2];
+
+static void toBytes(uint16_t length)
+{
+	for (uint16_t t = 0; t < NUM_TRANSFERS; t++)
+	{
+		bytes[t][0] = (uint8_t) (commands[t] >> 8);
+		bytes[t][1] = (uint8_t) commands[t];
+		for (uint16_t i = 0; i < length; i++)
+		{
+			bytes[t][2 + 2 * i] = (uint8_t) (words[t][i] >> 8);
+			bytes[t][3 + 2 * i] = (uint8_t) words[t][i];
+		}
+	}
+}
+
+static double benchBytes(crcBytes_t fn, uint16_t length)
+{
+	uint8_t acc = 0;
+	uint64_t start = benchCycles();
+	for (uint16_t r = 0; r < NUM_ROUNDS; r++)
+	{
+		for (uint16_t t = 0; t < NUM_TRANSFERS; t++)
+		{
+			acc ^= fn(bytes[t], (uint8_t) (2 * length + 2));
+		}
+	}
+	uint64_t stop = benchCycles();
+	benchKeep(acc);
+	return ((double) (stop - start) / ((double) NUM_ROUNDS * NUM_TRANSFERS * (length + 1)));
+}
+
+static double benchWords(crcWords_t fn, uint16_t length)
+{
+	uint8_t acc = 0;
+	uint64_t start = benchCycles();
+	for (uint16_t r = 0; r < NUM_ROUNDS; r++)
+	{
+		for (uint16_t t = 0; t < NUM_TRANSFERS; t++)
+		{
+			acc ^= fn(commands[t], words[t], length);
+		}
+	}
+	uint64_t stop = benchCycles();
+	benchKeep(acc);
+	return ((double) (stop - start) / ((double) NUM_ROUNDS * NUM_TRANSFERS * (length + 1)));
+}
+
+int main()
+{
+	static const uint16_t lengths[] = { 1, 2, 6, 8, 15 };
+	struct { const char *name; crcBytes_t fn; } byteFns[] = {
+		{ "bitwise", crc8Bitwise },
+		{ "nibble",  crc8Nibble  },
+		{ "table",   crc8Table   },
+	};
+	struct { const char *name; crcWords_t fn; } wordFns[] = {
+		{ "bitwise", crc8WordsBitwise },
+		{ "nibble",  crc8WordsNibble  },
+		{ "table",   crc8WordsTable   },
+	};
+	int failed = 0;
+
+	srand(5012);
+	for (uint16_t t = 0; t < NUM_TRANSFERS; t++)
+	{
+		commands[t] = (uint16_t) rand();
+		for (uint16_t i = 0; i < MAX_NUM_REG; i++)
+		{
+			words[t][i] = (uint16_t) rand();
+		}
+	}
+
+	printf("CRC8 safety word check, %s per verified 16 bit word (command word included)\n", benchCycleUnit());
+	printf("%-8s %-6s", "impl", "api");
+	for (uint16_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+	{
+		printf("  %2u words", lengths[l]);
+	}
+	printf("\n");
+
+	for (uint16_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+	{
+		toBytes(lengths[l]);
+		for (uint16_t t = 0; t < NUM_TRANSFERS; t++)
+		{
+			uint8_t ref = crc8Reference(bytes[t], (uint8_t) (2 * lengths[l] + 2));
+			for (uint8_t f = 0; f < 3; f++)
+			{
+				if (byteFns[f].fn(bytes[t], (uint8_t) (2 * lengths[l] + 2)) != ref
+					|| wordFns[f].fn(commands[t], words[t], lengths[l]) != ref)
+				{
+					failed++;
+				}
+			}
+			if (crc8Stream(commands[t], words[t], lengths[l]) != ref)
+			{
+				failed++;
+			}
+		}
+	}
+
+	for (uint8_t f = 0; f < 3; f++)
+	{
+		printf("%-8s %-6s", byteFns[f].name, "bytes");
+		for (uint16_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+		{
+			toBytes(lengths[l]);
+			printf("  %8.2f", benchBytes(byteFns[f].fn, lengths[l]));
+		}
+		printf("\n%-8s %-6s", wordFns[f].name, "words");
+		for (uint16_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+		{
+			printf("  %8.2f", benchWords(wordFns[f].fn, lengths[l]));
+		}
+		printf("\n");
+	}
+	printf("%-8s %-6s", "selected", "stream");
+	for (uint16_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+	{
+		printf("  %8.2f", benchWords(crc8Stream, lengths[l]));
+	}
+	printf("\n");
+
+	printf("selected implementation: %s\n",
+		(TLE5012_CRC_IMPL == TLE5012_CRC_TABLE) ? "table" : ((TLE5012_CRC_IMPL == TLE5012_CRC_NIBBLE) ? "nibble" : "bitwise"));
+	if (failed != 0)
+	{
+		printf("FAILED: %d CRC mismatches against the reference implementation\n", failed);
+		return (1);
+	}
+	return (0);
+}
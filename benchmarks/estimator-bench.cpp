@@ -0,0 +1,169 @@
+/**
+ * @file        estimator-bench.cpp
+ * @brief       Accuracy of the speed estimator against the simulated magnet
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Reads the simulated sensor at 10 kHz on the model clock and compares the
+ * speed of the difference mode, of the tracking mode and of ASPD with the
+ * speed of the trajectory, at a medium and at a low constant speed and
+ * while accelerating. Checks the acceleration of the tracking mode and that
+ * the predicted angle is closer to the actual magnet angle than the last
+ * angle value. Prints the errors and the time per update.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "bench.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define PERIOD_NS      100000ULL     /**< 10 kHz */
+#define SETTLE         500
+#define NUM_UPDATES    2000
+#define NUM_ROUNDS     1000000UL
+#define CONTROL_US     50            /**< time from the read to the use of the angle */
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Speed errors of one run in °/s
+ */
+struct runResult
+{
+	double rmsTrack;
+	double rmsDiff;
+	double rmsSpeed;             //!< \brief ASPD
+	double maxTrack;
+	double meanAccel;            //!< \brief tracking mode
+	double meanPredicted;        //!< \brief angle error after CONTROL_US
+	double meanRaw;
+};
+
+/**
+ * @brief Signed difference of two angles in °, wrapped to +-180°
+ */
+static double angleError(double a, double b)
+{
+	return (fmod(fmod(a - b, 360.0) + 540.0, 360.0) - 180.0);
+}
+
+static runResult run(double speed, double accel)
+{
+	Tle5012Host sensor;
+	Tle5012Estimator track;
+	Tle5012Estimator diff;
+	runResult r = { 0, 0, 0, 0, 0, 0, 0 };
+	sensor.begin();
+	sensor.sim.setTrajectory(30.0, speed, accel);
+	track.begin(sensor);
+	diff.setMode(Tle5012Estimator::ESTIMATOR_DIFF);
+	double frameTime = 42.7e-6;
+
+	for (uint32_t n = 0; n < SETTLE + NUM_UPDATES; n++)
+	{
+		sensor.sim.advance(PERIOD_NS);
+		// AVAL and FCNT of the same update period from the update buffer
+		Tle5012b::motionSnapshot s;
+		uint64_t readTime = sensor.sim.now();
+		sensor.sBus->triggerUpdate();
+		sensor.readMotionSnapshot(s, UPD_high);
+		track.update(s.rawAngle, s.frameCounter);
+		diff.update(s.rawAngle, s.frameCounter);
+		int32_t aspd = 0;
+		sensor.getAngleSpeedCdeg(aspd);
+		if (n < SETTLE)
+		{
+			continue;
+		}
+		// the angle value is about half an update period old at the trigger
+		double t = readTime * 1e-9 - (frameTime / 2);
+		double expected = speed + (accel * t);
+		double trackError = track.speedCdeg() / 100.0 - expected;
+		double diffError = diff.speedCdeg() / 100.0 - expected;
+		double speedError = aspd / 100.0 - expected;
+		r.rmsTrack += trackError * trackError;
+		r.rmsDiff += diffError * diffError;
+		r.rmsSpeed += speedError * speedError;
+		r.maxTrack = fmax(r.maxTrack, fabs(trackError));
+		r.meanAccel += track.accelDeg();
+
+		// latency from the middle of the update period before the trigger to the use
+		uint32_t latency = (uint32_t) ((sensor.sim.now() - readTime) / 1000) + CONTROL_US + 21;
+		double actual = sensor.sim.angleAt(sensor.sim.now() * 1e-9 + CONTROL_US * 1e-6);
+		r.meanPredicted += fabs(angleError(track.predictQ16(latency) * (360.0 / 65536.0), actual));
+		r.meanRaw += fabs(angleError(s.rawAngle * (360.0 / 32768.0), actual));
+	}
+	r.rmsTrack = sqrt(r.rmsTrack / NUM_UPDATES);
+	r.rmsDiff = sqrt(r.rmsDiff / NUM_UPDATES);
+	r.rmsSpeed = sqrt(r.rmsSpeed / NUM_UPDATES);
+	r.meanAccel /= NUM_UPDATES;
+	r.meanPredicted /= NUM_UPDATES;
+	r.meanRaw /= NUM_UPDATES;
+	return (r);
+}
+
+static void print(const char *name, runResult &r)
+{
+	printf("%-18s rms track %7.2f, diff %7.2f, ASPD %7.2f deg/s, angle after %u us %.4f / raw %.4f deg\n",
+		name, r.rmsTrack, r.rmsDiff, r.rmsSpeed, CONTROL_US, r.meanPredicted, r.meanRaw);
+}
+
+int main()
+{
+	int failed = 0;
+
+	runResult medium = run(3000.0, 0.0);
+	print("3000 deg/s", medium);
+	CHECK(medium.rmsTrack < 5.0);
+	CHECK(medium.rmsTrack < medium.rmsDiff / 4);
+	CHECK(medium.meanPredicted < medium.meanRaw / 4);
+	CHECK(fabs(medium.meanAccel) < 100.0);
+
+	runResult slow = run(10.0, 0.0);
+	print("10 deg/s", slow);
+	CHECK(slow.rmsTrack < 2.0);
+	CHECK(slow.rmsTrack < slow.rmsDiff / 4);
+
+	runResult accelerating = run(-500.0, 20000.0);
+	print("20000 deg/s^2", accelerating);
+	CHECK(accelerating.maxTrack < 10.0);
+	CHECK(fabs(accelerating.meanAccel - 20000.0) < 400.0);
+	CHECK(accelerating.meanPredicted < accelerating.meanRaw / 4);
+	printf("acceleration       mean %.0f deg/s^2\n", accelerating.meanAccel);
+
+	// update rates, stale reads and the time per update
+	Tle5012Estimator estimator;
+	estimator.setFrameTime(0);
+	CHECK(estimator.getFrameTime() == ESTIMATOR_MIN_FRAME_TIME);
+	estimator.setUpdateRate(3);
+	estimator.update(0, 0);
+	estimator.update(1000, 10);
+	estimator.update(1000, 10);
+	CHECK(estimator.stale == 1);
+	CHECK(estimator.updates == 1);
+	estimator.setMode(Tle5012Estimator::ESTIMATOR_DIFF);
+	estimator.update(-16000, 60);
+	estimator.update(16000, 61);
+	CHECK(estimator.speedCdeg() == (int32_t) lround(-768 * (36000.0 / 32768.0) / 170.6e-6));
+
+	estimator.setMode(Tle5012Estimator::ESTIMATOR_TRACK);
+	int16_t angle = 0;
+	uint64_t start = benchNanos();
+	for (uint32_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		angle = (int16_t) (((angle + 100 + (n & 7)) & 0x7FFF) << 1) >> 1;
+		estimator.update(angle, (uint8_t) n);
+	}
+	double trackNs = (double) (benchNanos() - start) / NUM_ROUNDS;
+	benchKeep(estimator.speedCdeg());
+	start = benchNanos();
+	for (uint32_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		benchKeep(estimator.predictQ16(n & 0xFF));
+	}
+	double predictNs = (double) (benchNanos() - start) / NUM_ROUNDS;
+	printf("update             tracking %.1f ns, prediction %.1f ns\n", trackNs, predictNs);
+
+	return (failed == 0 ? 0 : 1);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file        fixed-bench.cpp
+ * @brief       Checks the integer get functions against the double ones
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Sweeps all raw angle, temperature and speed values, the latter for all
+ * FIR_MD settings, with and without prediction and for several angle
+ * ranges, through the register file and compares getAngleQ16,
+ * getTemperatureQ8 and getAngleSpeedCdeg with the double versions.
+ * The angle must be exact, the temperature within 1/256 °C and the speed
+ * within 0.5 cdeg/s plus the 2^-31 scale resolution or saturated. The
+ * speed is also checked against the former calculation from the six
+ * register burst, and that the cached speed scale follows writes of MOD_1
+ * and MOD_2. Prints the largest errors, the bus words and the time per
+ * speed read.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "bench.hpp"
+#include "bench-spic.hpp"
+
+#define NUM_ROUNDS    100
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+// none class function of TLE5012b.cpp, the former per call speed calculation
+double calculateAngleSpeed(double angRange, int16_t rawAngleSpeed, uint16_t firMD, uint16_t predictionVal);
+
+int main()
+{
+	BenchSPIC bus;
+	Tle5012b sensor;
+	int failed = 0;
+	errorTypes status;
+
+	sensor.sBus = &bus;
+
+	// angle, all 15 bit values
+	uint32_t angleErrors = 0;
+	for (uint32_t raw = 0; raw < 0x8000; raw++)
+	{
+		double angle = 0;
+		int16_t rawAngle = 0;
+		int32_t angleQ16 = 0;
+		bus.regs[0x02] = (uint16_t) (0x8000 | raw);
+		status = sensor.getAngleValue(angle, rawAngle);
+		CHECK(status == NO_ERROR);
+		status = sensor.getAngleQ16(angleQ16);
+		CHECK(status == NO_ERROR);
+		if ((angleQ16 * (360.0 / 65536.0)) != angle)
+		{
+			angleErrors++;
+		}
+	}
+	printf("angle Q16          %5u values, %u not exact\n", 0x8000, angleErrors);
+	CHECK(angleErrors == 0);
+
+	// temperature, all 9 bit values
+	double tempMaxError = 0;
+	for (uint32_t raw = 0; raw < 0x200; raw++)
+	{
+		double temperature = 0;
+		int16_t rawTemp = 0;
+		int32_t temperatureQ8 = 0;
+		bus.regs[0x05] = (uint16_t) raw;
+		status = sensor.getTemperature(temperature, rawTemp);
+		CHECK(status == NO_ERROR);
+		status = sensor.getTemperatureQ8(temperatureQ8);
+		CHECK(status == NO_ERROR);
+		tempMaxError = fmax(tempMaxError, fabs(temperatureQ8 / 256.0 - temperature));
+	}
+	printf("temperature Q8     %5u values, max error %.5f degC\n", 0x200, tempMaxError);
+	CHECK(tempMaxError <= 1.0 / 256.0);
+
+	// speed, all 15 bit values for all FIR_MD, prediction and some angle ranges,
+	// compared with the former per call calculation
+	const uint16_t angleRanges[] = { 0x001, 0x080, 0x200, 0x7FF };
+	double speedMaxError = 0;
+	double scaleMaxError = 0;
+	uint32_t speedValues = 0;
+	uint32_t saturated = 0;
+	for (uint8_t r = 0; r < sizeof(angleRanges) / sizeof(angleRanges[0]); r++)
+	{
+		for (uint16_t firMD = 0; firMD < 4; firMD++)
+		{
+			for (uint16_t pred = 0; pred < 2; pred++)
+			{
+				bus.regs[0x06] = (uint16_t) (firMD << 14);
+				bus.regs[0x08] = (uint16_t) ((angleRanges[r] << 4) | (pred << 2));
+				// the register file changed behind the driver
+				sensor.reg.invalidateCache(Reg::MASK_MOD_1 | Reg::MASK_MOD_2);
+				double angleRange = 360.0 * (128.0 / angleRanges[r]);
+				for (uint32_t raw = 0; raw < 0x8000; raw++)
+				{
+					double speed = 0;
+					int16_t rawSpeed = 0;
+					int32_t speedCdeg = 0;
+					bus.regs[0x03] = (uint16_t) raw;
+					status = sensor.getAngleSpeed(speed, rawSpeed);
+					CHECK(status == NO_ERROR);
+					status = sensor.getAngleSpeedCdeg(speedCdeg);
+					CHECK(status == NO_ERROR);
+					double reference = calculateAngleSpeed(angleRange, rawSpeed, firMD, 2 + pred);
+					speedValues++;
+					scaleMaxError = fmax(scaleMaxError, fabs(speed - reference) / fmax(fabs(reference), 1.0));
+					if (fabs(reference * 100.0) > 2147483647.0)
+					{
+						saturated++;
+						CHECK(speedCdeg == (reference < 0 ? -0x7FFFFFFF : 0x7FFFFFFF));
+						continue;
+					}
+					double error = fabs(speedCdeg / 100.0 - reference);
+					speedMaxError = fmax(speedMaxError, error);
+					if (error > 0.005 + fabs(reference) / 2147483648.0)
+					{
+						printf("FAILED: speed raw %u firMD %u pred %u range 0x%03X: %f != %d cdeg/s\n",
+							raw, firMD, pred, angleRanges[r], reference, speedCdeg);
+						failed++;
+					}
+				}
+			}
+		}
+	}
+	printf("speed double     %7u values, max relative error %.2e\n", speedValues, scaleMaxError);
+	printf("speed cdeg/s     %7u values, %u saturated, max error %.5f deg/s\n", speedValues, saturated, speedMaxError);
+	CHECK(scaleMaxError <= 1e-12);
+
+	// the speed scale follows the writes of the driver
+	double speed = 0;
+	int16_t rawSpeed = 0;
+	bus.regs[0x03] = 0x0100;
+	sensor.reg.setAngleRange(Reg::factor1);
+	sensor.reg.disablePrediction();
+	sensor.getAngleSpeed(speed, rawSpeed);
+	CHECK(fabs(speed - calculateAngleSpeed(360.0, rawSpeed, bus.regs[0x06] >> 14, 2)) < 1e-9);
+	sensor.reg.enablePrediction();
+	sensor.getAngleSpeed(speed, rawSpeed);
+	CHECK(fabs(speed - calculateAngleSpeed(360.0, rawSpeed, bus.regs[0x06] >> 14, 3)) < 1e-9);
+
+	// bus words and time per call with the cached scale
+	uint32_t words = bus.words;
+	uint64_t start = benchNanos();
+	for (uint16_t n = 0; n < NUM_ROUNDS * 100; n++)
+	{
+		sensor.getAngleSpeed(speed, rawSpeed);
+		benchKeep(speed);
+	}
+	double doubleNs = (double) (benchNanos() - start) / (NUM_ROUNDS * 100);
+	double doubleWords = (double) (bus.words - words) / (NUM_ROUNDS * 100);
+	int32_t speedCdeg = 0;
+	start = benchNanos();
+	for (uint16_t n = 0; n < NUM_ROUNDS * 100; n++)
+	{
+		sensor.getAngleSpeedCdeg(speedCdeg);
+		benchKeep(speedCdeg);
+	}
+	double cdegNs = (double) (benchNanos() - start) / (NUM_ROUNDS * 100);
+	printf("getAngleSpeed      %.1f words, %.1f ns per call, getAngleSpeedCdeg %.1f ns per call\n", doubleWords, doubleNs, cdegNs);
+	CHECK(doubleWords == 3.0);
+
+	return (failed == 0 ? 0 : 1);
+}
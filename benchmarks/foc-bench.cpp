@@ -0,0 +1,143 @@
+/**
+ * @file        foc-bench.cpp
+ * @brief       Accuracy and speed of the electrical angle and the sin/cos table
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Checks the Q15 sine and cosine of the interpolated tables against the
+ * double precision functions for all 65536 angles, with the default table
+ * and with the small AVR table, and the electrical angle for several pole
+ * pairs, zero offsets and both directions. Runs the sensor path against the
+ * simulated magnet and prints the time per sin/cos against sin() and cos().
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "bench.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_ROUNDS     1000000UL
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Largest error in Q15 LSB over all angles of a table size
+ */
+template<uint8_t BITS>
+static double maxError()
+{
+	double worst = 0;
+	for (uint32_t a = 0; a < 65536; a++)
+	{
+		int16_t s = 0;
+		int16_t c = 0;
+		focSinCosQ15<BITS>((uint16_t) a, s, c);
+		double x = a * (2.0 * M_PI / 65536.0);
+		worst = fmax(worst, fabs(s - 32767.0 * sin(x)));
+		worst = fmax(worst, fabs(c - 32767.0 * cos(x)));
+	}
+	return (worst);
+}
+
+int main()
+{
+	int failed = 0;
+
+	// table errors, 0.5 LSB rounding of the table and of the interpolation plus the
+	// chord error of 32767 * (pi / 2 / segments)^2 / 8, 0.15 LSB with 256 segments
+	double error8 = maxError<8>();
+	double error6 = maxError<6>();
+	printf("sin/cos            max error %.2f LSB (256 segments), %.2f LSB (64)\n", error8, error6);
+	CHECK(error8 <= 1.2);
+	CHECK(error6 <= 3.5);
+	int16_t s = 0;
+	int16_t c = 0;
+	Tle5012Foc::sinCosQ15(0, s, c);
+	CHECK((s == 0) && (c == 32767));
+	Tle5012Foc::sinCosQ15(16384, s, c);
+	CHECK((s == 32767) && (c == 0));
+	Tle5012Foc::sinCosQ15(32768, s, c);
+	CHECK((s == 0) && (c == -32767));
+	Tle5012Foc::sinCosQ15(49152, s, c);
+	CHECK((s == -32767) && (c == 0));
+
+	// electrical angle, exact in 16 bit for all pole pairs, offsets and directions
+	Tle5012Foc foc;
+	const uint8_t pairs[] = { 1, 2, 4, 7, 21 };
+	const uint16_t zeros[] = { 0, 1234, 40000 };
+	uint32_t mismatches = 0;
+	for (uint8_t p = 0; p < sizeof(pairs); p++)
+	{
+		for (uint8_t z = 0; z < sizeof(zeros) / sizeof(zeros[0]); z++)
+		{
+			for (uint8_t r = 0; r < 2; r++)
+			{
+				foc.setPolePairs(pairs[p]);
+				foc.setZero(zeros[z]);
+				foc.setDirection(r != 0);
+				for (int32_t angle = -65536; angle < 65536 * 2; angle += 7)
+				{
+					int64_t mechanical = (r != 0) ? -angle : angle;
+					uint16_t expected = (uint16_t) (((mechanical * pairs[p] - zeros[z]) % 65536 + 65536) % 65536);
+					mismatches += (foc.electricalQ16(angle) != expected);
+				}
+			}
+		}
+	}
+	printf("electrical angle   %u mismatches\n", mismatches);
+	CHECK(mismatches == 0);
+	foc.setPolePairs(0);
+	foc.setZero(0);
+	foc.setDirection(false);
+	CHECK(foc.electricalQ16(1000) == 1000);
+
+	// alignment, the aligned angle is electrical 0, a quarter electrical turn later sin is 1
+	foc.setPolePairs(4);
+	foc.setDirection(true);
+	foc.alignZero(12345);
+	foc.update(12345);
+	CHECK((foc.electrical == 0) && (foc.sinQ15 == 0) && (foc.cosQ15 == 32767));
+	foc.update(12345 - 4096);
+	CHECK((foc.electrical == 16384) && (foc.sinQ15 == 32767));
+
+	// sensor path, raw 15 bit angle to electrical sin/cos
+	Tle5012Host sensor;
+	sensor.begin();
+	sensor.sim.setTrajectory(100.0, 0.0, 0.0);
+	sensor.sim.advance(100000);
+	foc.setPolePairs(7);
+	foc.setDirection(false);
+	foc.setZero(0);
+	CHECK(foc.update(sensor) == NO_ERROR);
+	double electrical = fmod(100.0 * 7, 360.0) * M_PI / 180.0;
+	double sensorError = fmax(fabs(foc.sinQ15 / 32767.0 - sin(electrical)), fabs(foc.cosQ15 / 32767.0 - cos(electrical)));
+	printf("sensor path        electrical %u, error %.5f\n", foc.electrical, sensorError);
+	CHECK(sensorError < 0.002);
+
+	// time per sin/cos
+	uint64_t start = benchNanos();
+	for (uint32_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		Tle5012Foc::sinCosQ15((uint16_t) (n * 40503U), s, c);
+		benchKeep(s + c);
+	}
+	double tableNs = (double) (benchNanos() - start) / NUM_ROUNDS;
+	start = benchNanos();
+	for (uint32_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		double x = (uint16_t) (n * 40503U) * (2.0 * M_PI / 65536.0);
+		benchKeep((int32_t) (32767.0 * sin(x)) + (int32_t) (32767.0 * cos(x)));
+	}
+	double libmNs = (double) (benchNanos() - start) / NUM_ROUNDS;
+	start = benchNanos();
+	for (uint32_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		foc.update((int32_t) (n * 13U));
+		benchKeep(foc.sinQ15);
+	}
+	double updateNs = (double) (benchNanos() - start) / NUM_ROUNDS;
+	printf("sin/cos            table %.1f ns, libm %.1f ns, electrical + sin/cos %.1f ns\n", tableNs, libmNs, updateNs);
+
+	return (failed == 0 ? 0 : 1);
+}
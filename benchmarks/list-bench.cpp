@@ -0,0 +1,157 @@
+/**
+ * @file        list-bench.cpp
+ * @brief       Bus throughput of command lists against one transaction per command
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Reads register sets from the simulated sensor at the 1 MHz SSC clock of
+ * the Arduino PAL with host costs for the bus setup, the pin direction
+ * changes and the turnaround wait of the 3wire interface. Compares one
+ * transaction per register, one transaction per planned burst and the whole
+ * plan as one command list, and prints the model time per cycle and the bus
+ * words per second. Checks that the list reads the same values and stops at
+ * a failed safety word.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include <string.h>
+#include "bench.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_ROUNDS     100
+#define SPI_CLOCK      1000000       /**< SPEED of SPIClass3W */
+#define SETUP_NS       2000          /**< assumed beginTransaction and MISO setup */
+#define PIN_NS         1500          /**< assumed pinMode */
+#define TURN_NS        5000          /**< SPI3W_TURNAROUND_US of SPIClass3W */
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Model time and bus words of one read cycle
+ */
+struct cycleResult
+{
+	double   micros;
+	uint32_t words;
+};
+
+static void setCosts(Tle5012Host &sensor, bool on)
+{
+	sensor.sim.spiClock = SPI_CLOCK;
+	sensor.bus.setupTime = on ? SETUP_NS : 0;
+	sensor.bus.pinTime = on ? PIN_NS : 0;
+	sensor.bus.turnTime = on ? TURN_NS : 0;
+}
+
+/**
+ * @brief Runs a cycle NUM_ROUNDS times, mode 0 one read per register,
+ * 1 one transaction per burst, 2 the plan as command list
+ */
+static cycleResult run(Tle5012Host &sensor, uint32_t mask, uint8_t mode, int &failed)
+{
+	Tle5012b::readPlan plan;
+	uint16_t data[MAX_NUM_REG];
+	sensor.planRead(mask, plan);
+	uint64_t words = sensor.sim.words;
+	uint64_t start = sensor.sim.now();
+	for (uint16_t r = 0; r < NUM_ROUNDS; r++)
+	{
+		if (mode == 0)
+		{
+			for (uint8_t i = 0; i < MAX_NUM_REG; i++)
+			{
+				if (mask & (1UL << i))
+				{
+					failed += (sensor.readFromSensor(sensor.reg.addrFields[i].regAddress, data[0]) != NO_ERROR);
+				}
+			}
+		}else if (mode == 1)
+		{
+			for (uint8_t i = 0; i < plan.numBursts; i++)
+			{
+				failed += (sensor.readMoreRegisters(plan.bursts[i].command, data) != NO_ERROR);
+			}
+		}else{
+			failed += (sensor.readPlanned(plan) != NO_ERROR);
+		}
+	}
+	cycleResult result;
+	result.micros = (double) (sensor.sim.now() - start) / NUM_ROUNDS / 1000.0;
+	result.words = (uint32_t) ((sensor.sim.words - words) / NUM_ROUNDS);
+	return (result);
+}
+
+int main()
+{
+	struct { const char *name; uint32_t mask; } sets[] = {
+		{ "stat+angle",             Reg::MASK_STAT | Reg::MASK_AVAL },
+		{ "angle+adc+t_raw",        Reg::MASK_AVAL | Reg::MASK_ADC_X | Reg::MASK_ADC_Y | Reg::MASK_T_RAW },
+		{ "motion+mod+iif",         Tle5012b::QUANTITY_ANGLE | Tle5012b::QUANTITY_SPEED
+			| Tle5012b::QUANTITY_REVOLUTIONS | Reg::MASK_MOD_4 | Reg::MASK_IIF_CNT },
+		{ "all registers",          Reg::MASK_ALL },
+	};
+	int failed = 0;
+	Tle5012Host sensor;
+	sensor.begin();
+	sensor.sim.setTrajectory(123.0, 0.0, 0.0);
+
+	printf("%-18s %6s %6s %12s %12s %12s %10s %10s\n", "register set", "words", "cmds", "single us", "bursts us",
+		"list us", "kw/s burst", "kw/s list");
+	for (uint8_t s = 0; s < sizeof(sets) / sizeof(sets[0]); s++)
+	{
+		Tle5012b::readPlan plan;
+		sensor.planRead(sets[s].mask, plan);
+		setCosts(sensor, true);
+		cycleResult single = run(sensor, sets[s].mask, 0, failed);
+		cycleResult bursts = run(sensor, sets[s].mask, 1, failed);
+		cycleResult list = run(sensor, sets[s].mask, 2, failed);
+		printf("%-18s %6u %6u %12.1f %12.1f %12.1f %10.1f %10.1f\n", sets[s].name, list.words, plan.numBursts,
+			single.micros, bursts.micros, list.micros, bursts.words / bursts.micros * 1000.0, list.words / list.micros * 1000.0);
+		CHECK(list.words == plan.words);
+		CHECK(bursts.words == list.words);
+		CHECK(list.micros <= bursts.micros);
+		if (plan.numBursts > 1)
+		{
+			// saves the setup and the MISO setup of every command but the first
+			CHECK(bursts.micros - list.micros >= (plan.numBursts - 1) * (SETUP_NS / 1000.0) - 0.001);
+		}
+
+		// without host costs the list is exactly as fast as the single transactions
+		setCosts(sensor, false);
+		bursts = run(sensor, sets[s].mask, 1, failed);
+		list = run(sensor, sets[s].mask, 2, failed);
+		CHECK(fabs(bursts.micros - list.micros) < 0.001);
+	}
+
+	// the list stores the same values as the single reads
+	setCosts(sensor, true);
+	uint16_t single[MAX_NUM_REG];
+	for (uint8_t i = 0; i < MAX_NUM_REG; i++)
+	{
+		failed += (sensor.readFromSensor(sensor.reg.addrFields[i].regAddress, single[i]) != NO_ERROR);
+	}
+	memset(sensor.reg.regMap, 0, sizeof(sensor.reg.regMap));
+	CHECK(sensor.readRegisters(Reg::MASK_AVAL | Reg::MASK_MOD_1 | Reg::MASK_MOD_2 | Reg::MASK_CRC | Reg::MASK_T25O) == NO_ERROR);
+	uint32_t stable = Reg::MASK_AVAL | Reg::MASK_MOD_1 | Reg::MASK_MOD_2 | Reg::MASK_CRC | Reg::MASK_T25O;
+	uint32_t mismatches = 0;
+	for (uint8_t i = 0; i < MAX_NUM_REG; i++)
+	{
+		mismatches += ((stable & (1UL << i)) && (sensor.reg.regMap[i] != single[i]));
+	}
+	CHECK(mismatches == 0);
+
+	// a failed safety word in the list is reported and the later bursts are not stored
+	Tle5012b::readPlan plan;
+	sensor.planRead(Reg::MASK_AVAL | Reg::MASK_T25O, plan);
+	CHECK(plan.numBursts == 2);
+	memset(sensor.reg.regMap, 0, sizeof(sensor.reg.regMap));
+	sensor.sim.injectCrcError(1);
+	CHECK(sensor.readPlanned(plan) == CRC_ERROR);
+	CHECK(sensor.reg.regMap[21] == 0);
+	CHECK(sensor.readPlanned(plan) == NO_ERROR);
+	CHECK(sensor.reg.regMap[21] == single[21]);
+
+	return (failed == 0 ? 0 : 1);
+}
@@ -0,0 +1,93 @@
+/**
+ * @file        planner-bench.cpp
+ * @brief       Compares planned burst reads with one read per register
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Reads typical register sets once with the register getters, one transfer
+ * per register, and once with a read plan. Prints the bus words and chip
+ * select cycles of both and checks that the plan stores the same values
+ * in regMap.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.hpp"
+#include "bench-spic.hpp"
+
+#define NUM_ROUNDS    10000
+
+int main()
+{
+	struct { const char *name; uint32_t mask; } sets[] = {
+		{ "angle+speed+range+temp", Tle5012b::QUANTITY_ANGLE | Tle5012b::QUANTITY_SPEED
+			| Tle5012b::QUANTITY_RANGE | Tle5012b::QUANTITY_TEMPERATURE },
+		{ "angle+revolutions",      Tle5012b::QUANTITY_ANGLE | Tle5012b::QUANTITY_REVOLUTIONS },
+		{ "crc registers 08-0F",    Reg::MASK_MOD_2 | Reg::MASK_MOD_3 | Reg::MASK_OFFX | Reg::MASK_OFFY
+			| Reg::MASK_SYNCH | Reg::MASK_IFAB | Reg::MASK_MOD_4 | Reg::MASK_TCO_Y },
+		{ "stat+mod_1+adc+t25o",    Reg::MASK_STAT | Reg::MASK_MOD_1 | Reg::MASK_ADC_X | Reg::MASK_ADC_Y | Reg::MASK_T25O },
+		{ "all registers",          Reg::MASK_ALL },
+	};
+	BenchSPIC bus;
+	Tle5012b sensor;
+	int failed = 0;
+
+	sensor.sBus = &bus;
+	printf("%-24s %8s %8s %8s %8s %6s %10s %10s\n", "register set", "words", "planned", "saved", "cs", "bursts",
+		"single ns", "planned ns");
+	for (uint8_t s = 0; s < sizeof(sets) / sizeof(sets[0]); s++)
+	{
+		uint16_t single[MAX_NUM_REG] = {};
+		Tle5012b::readPlan plan;
+
+		bus.words = 0;
+		bus.transfers = 0;
+		uint64_t start = benchNanos();
+		for (uint16_t r = 0; r < NUM_ROUNDS; r++)
+		{
+			for (uint8_t i = 0; i < MAX_NUM_REG; i++)
+			{
+				if (sets[s].mask & (1UL << i))
+				{
+					failed += (sensor.readFromSensor(sensor.reg.addrFields[i].regAddress, single[i]) != NO_ERROR);
+				}
+			}
+		}
+		uint64_t singleNs = benchNanos() - start;
+		uint32_t singleWords = bus.words / NUM_ROUNDS;
+		uint32_t singleCs = bus.transfers / NUM_ROUNDS;
+
+		sensor.planRead(sets[s].mask, plan);
+		memset(sensor.reg.regMap, 0, sizeof(sensor.reg.regMap));
+		bus.words = 0;
+		bus.transfers = 0;
+		start = benchNanos();
+		for (uint16_t r = 0; r < NUM_ROUNDS; r++)
+		{
+			failed += (sensor.readPlanned(plan) != NO_ERROR);
+		}
+		uint64_t plannedNs = benchNanos() - start;
+
+		for (uint8_t i = 0; i < MAX_NUM_REG; i++)
+		{
+			if ((sets[s].mask & (1UL << i)) && (sensor.reg.regMap[i] != single[i]))
+			{
+				failed++;
+			}
+		}
+		if ((singleWords != plan.singleWords) || (bus.words / NUM_ROUNDS != plan.words))
+		{
+			failed++;
+		}
+		printf("%-24s %8u %8u %8u %3u/%-4u %6u %10.1f %10.1f\n", sets[s].name, singleWords, plan.words, plan.wordsSaved(),
+			singleCs, bus.transfers / NUM_ROUNDS, plan.numBursts,
+			(double) singleNs / NUM_ROUNDS, (double) plannedNs / NUM_ROUNDS);
+	}
+
+	if (failed != 0)
+	{
+		printf("FAILED: %d mismatches between planned and single register reads\n", failed);
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,187 @@
+/**
+ * @file        position-bench.cpp
+ * @brief       Checks the multi-turn position on the simulated sensor
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Turns the simulated magnet at 6000 rpm for more than 512 turns in both
+ * directions, so the 9 bit revolution counter wraps several times, and
+ * compares the position with the model angle. Feeds glitches into the
+ * position, which must be rejected once and taken after a row of rejects,
+ * and reads more than 64 update periods apart with the frames of the caller.
+ * Checks the zero offset and the gear ratio and prints the time per update
+ * from the snapshot and per update on the simulated bus.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "bench.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define SPEED_DEG      36000.0       /**< 6000 rpm */
+#define PERIOD_NS      500000ULL
+#define NUM_UPDATES    20000
+#define NUM_ROUNDS     1000000UL
+#define LSB_PER_DEG    (32768.0 / 360.0)
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Runs the magnet with a speed and returns the largest position error in degree
+ */
+static double track(Tle5012Host &sensor, Tle5012Position &position, double speed, updTypes upd, int &failed)
+{
+	double maxError = 0;
+	sensor.sim.setTrajectory(10.0, speed);
+	sensor.sim.advance(PERIOD_NS);
+	position.reset();
+	uint64_t start = sensor.sim.now();
+	if (upd == UPD_high)
+	{
+		sensor.sBus->triggerUpdate();
+	}
+	CHECK(position.update(sensor, upd) == NO_ERROR);
+	double first = sensor.sim.angleAt(start * 1e-9);
+	double firstPosition = (double) position.position() / LSB_PER_DEG;
+	for (uint32_t n = 0; n < NUM_UPDATES; n++)
+	{
+		sensor.sim.advance(PERIOD_NS);
+		uint64_t time = sensor.sim.now();
+		if (upd == UPD_high)
+		{
+			sensor.sBus->triggerUpdate();
+			CHECK(position.update(sensor, upd) == NO_ERROR);
+		}else if (position.update(sensor, upd) != NO_ERROR){
+			continue;
+		}
+		double expected = sensor.sim.angleAt(time * 1e-9) - first;
+		double actual = (double) position.position() / LSB_PER_DEG - firstPosition;
+		maxError = fmax(maxError, fabs(actual - expected));
+	}
+	return (maxError);
+}
+
+int main()
+{
+	Tle5012Host sensor;
+	Tle5012Position position;
+	int failed = 0;
+
+	CHECK(sensor.begin() == NO_ERROR);
+
+	// 6000 rpm, 18° per update, the counter wraps after 512 turns
+	double turns = SPEED_DEG * (NUM_UPDATES * PERIOD_NS * 1e-9) / 360.0;
+	double bound = SPEED_DEG * (85300 + 10000) * 1e-9 + 0.05;
+	double forward = track(sensor, position, SPEED_DEG, UPD_high, failed);
+	CHECK(forward < bound);
+	CHECK(position.turns() > 512);
+	CHECK(position.rejected == 0);
+	double backward = track(sensor, position, -SPEED_DEG, UPD_high, failed);
+	CHECK(backward < bound);
+	CHECK(position.turns() < -512);
+	CHECK(position.rejected == 0);
+	printf("update buffer      %.0f turns each way, max error %.3f / %.3f deg, bound %.3f deg\n",
+		turns, forward, backward, bound);
+
+	// without the update buffer a new period may start between AVAL and AREV
+	position.setMaxStep((uint16_t) (SPEED_DEG * 42700e-9 * LSB_PER_DEG * 1.5));
+	double torn = track(sensor, position, SPEED_DEG, UPD_low, failed);
+	CHECK(torn < bound);
+	CHECK(position.rejected > 0);
+	CHECK(position.resyncs == 0);
+	printf("direct reads       max error %.3f deg, %u torn reads rejected\n", torn, position.rejected);
+
+	// glitches, a counter from another period and a random angle
+	position.reset();
+	position.setMaxStep(2000);
+	Tle5012b::motionSnapshot s;
+	s.rawAngle = 16000;
+	s.rawSpeed = 0;
+	s.revolutions = 255;
+	s.rawTemp = 0;
+	s.frameCounter = 10;
+	s.frameSync = 0;
+	CHECK(position.update(s) == NO_ERROR);
+	int64_t base = position.position();
+	// the counter wraps from 255 to -256 together with the angle
+	s.revolutions = -256;
+	s.rawAngle = -16000;
+	s.frameCounter = 11;
+	CHECK(position.update(s) == NO_ERROR);
+	CHECK(position.position() == base + 768);
+	// AREV from the next update period
+	s.revolutions = -255;
+	s.frameCounter = 12;
+	CHECK(position.update(s) == ANGLE_SPEED_ERROR);
+	CHECK(position.position() == base + 768);
+	s.revolutions = -256;
+	s.rawAngle = -14500;
+	s.frameCounter = 12;
+	CHECK(position.update(s) == NO_ERROR);
+	CHECK(position.position() == base + 2268);
+	// 5 frames since the last update allow 5 steps
+	s.rawAngle = -5000;
+	s.frameCounter = 17;
+	CHECK(position.update(s) == NO_ERROR);
+	CHECK(position.rejected == 1);
+	// a real jump is taken after three rejects in a row
+	s.rawAngle = 10000;
+	for (uint8_t n = 0; n < POSITION_MAX_REJECTS; n++)
+	{
+		s.frameCounter++;
+		CHECK(position.update(s) == ((n < POSITION_MAX_REJECTS - 1) ? ANGLE_SPEED_ERROR : NO_ERROR));
+	}
+	CHECK(position.resyncs == 1);
+	CHECK(position.position() == base + 768 + 26000);
+	// 100 frames apart FCNT counts 36, only the frames of the caller allow the 150000 LSBs
+	Tle5012b::motionSnapshot later = s;
+	later.revolutions = (int16_t) (s.revolutions + 5);
+	later.rawAngle = (int16_t) (s.rawAngle + 150000 - 5 * 32768);
+	later.frameCounter = (uint8_t) ((s.frameCounter + 100) & 0x3F);
+	CHECK(position.update(later) == ANGLE_SPEED_ERROR);
+	CHECK(position.update(later, 100) == NO_ERROR);
+	CHECK(position.position() == base + 768 + 26000 + 150000);
+	s.frameCounter = (uint8_t) ((later.frameCounter + 100) & 0x3F);
+	CHECK(position.update(s, 100) == NO_ERROR);
+	CHECK(position.position() == base + 768 + 26000);
+	CHECK(position.resyncs == 1);
+	position.setMaxStep(0);
+
+	// zero and gear ratio, 1 to 36 reduction in 0.01°
+	position.setZero();
+	CHECK(position.position() == 0);
+	CHECK(position.turns() == 0);
+	s.revolutions = (int16_t) (s.revolutions + 36);
+	CHECK(position.update(s) == NO_ERROR);
+	CHECK(position.position() == 36 * 32768);
+	position.setGearRatio(36000, 36 * 32768);
+	CHECK(position.scaled() == 36000);
+	s.revolutions = (int16_t) (s.revolutions - 72);
+	s.rawAngle = (int16_t) (s.rawAngle - 1);
+	CHECK(position.update(s) == NO_ERROR);
+	CHECK(position.turns() == -37);
+	CHECK(position.scaled() == -36000);
+	position.setZero(0);
+	CHECK(position.turns() == 256 + 36 - 72);
+
+	// time per update
+	uint64_t start = benchNanos();
+	for (uint32_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		s.rawAngle = (int16_t) (s.rawAngle + 1000);
+		s.frameCounter++;
+		position.update(s);
+	}
+	double snapshotNs = (double) (benchNanos() - start) / NUM_ROUNDS;
+	benchKeep(position.position());
+	start = benchNanos();
+	for (uint32_t n = 0; n < NUM_UPDATES; n++)
+	{
+		position.update(sensor);
+	}
+	double busNs = (double) (benchNanos() - start) / NUM_UPDATES;
+	printf("update             from snapshot %.1f ns, with burst read on the model %.1f ns\n", snapshotNs, busNs);
+
+	return (failed == 0 ? 0 : 1);
+}
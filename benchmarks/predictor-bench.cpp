@@ -0,0 +1,148 @@
+/**
+ * @file        predictor-bench.cpp
+ * @brief       Accuracy of the latency compensated angle on the simulated sensor
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Runs a 10 kHz control loop on the model clock with the magnet at
+ * 6000 rpm, which reads the sensor, processes for a while and applies its
+ * output a bit later. Compares the angle for the output time from the
+ * predictor with the last angle value and with an extrapolation over the
+ * mean pipeline delay, with and without the prediction of the sensor.
+ * Checks the calibration of the read time and the update period, reads
+ * after a gap longer than the frame counter wrap and prints the errors.
+ * The bus is fast against the update period, so the read time is small.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "bench.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define SPEED_DEG      36000.0       /**< 6000 rpm */
+#define PERIOD_US      100           /**< 10 kHz */
+#define PROCESS_US     20            /**< from the read to the output calculation */
+#define OUTPUT_US      30            /**< from the calculation to the output */
+#define SETTLE         500
+#define NUM_CYCLES     3000
+#define NUM_ROUNDS     1000000UL
+#define SPI_CLOCK      8000000       /**< a fast SSC bus without turnaround wait */
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Mean and max angle errors in ° of one run
+ */
+struct runResult
+{
+	double meanLast;
+	double meanFixed;
+	double meanPredicted;
+	double maxPredicted;
+};
+
+static double angleError(int32_t angleQ16, double expected)
+{
+	double angle = angleQ16 * (360.0 / 65536.0);
+	return (fabs(fmod(fmod(angle - expected, 360.0) + 540.0, 360.0) - 180.0));
+}
+
+static runResult run(Tle5012Host &sensor, TimerHost &timer, Tle5012Predictor &predictor)
+{
+	runResult r = { 0, 0, 0, 0 };
+	uint32_t elapsed = 0;
+	timer.elapsedMicro(elapsed);
+	uint64_t origin = sensor.sim.now() - (uint64_t) elapsed * 1000;
+	for (uint32_t n = 0; n < SETTLE + NUM_CYCLES; n++)
+	{
+		sensor.sim.advance(PERIOD_US * 1000);
+		predictor.update();
+		timer.delayMicro(PROCESS_US);
+		uint32_t output = 0;
+		timer.elapsedMicro(output);
+		output += OUTPUT_US;
+		if (n < SETTLE)
+		{
+			continue;
+		}
+		double expected = sensor.sim.angleAt((origin + (uint64_t) output * 1000) * 1e-9);
+		int32_t fixed = predictor.estimator.predictQ16(predictor.delayMicro() + PROCESS_US + OUTPUT_US);
+		double error = angleError(predictor.angleAtQ16(output), expected);
+		r.meanLast += angleError(predictor.estimator.angleQ16(), expected);
+		r.meanFixed += angleError(fixed, expected);
+		r.meanPredicted += error;
+		r.maxPredicted = fmax(r.maxPredicted, error);
+	}
+	r.meanLast /= NUM_CYCLES;
+	r.meanFixed /= NUM_CYCLES;
+	r.meanPredicted /= NUM_CYCLES;
+	return (r);
+}
+
+static void print(const char *name, runResult &r)
+{
+	printf("%-18s mean error last %.3f, mean delay %.3f, predicted %.4f (max %.4f) deg\n",
+		name, r.meanLast, r.meanFixed, r.meanPredicted, r.maxPredicted);
+}
+
+int main()
+{
+	int failed = 0;
+	Tle5012Host sensor;
+	TimerHost timer(&sensor.sim);
+	Tle5012Predictor predictor(sensor, timer);
+
+	sensor.sim.spiClock = SPI_CLOCK;
+	sensor.bus.turnTime = 0;
+	CHECK(sensor.begin() == NO_ERROR);
+	sensor.sim.setTrajectory(0.0, SPEED_DEG);
+	CHECK(predictor.begin() == NO_ERROR);
+	CHECK(!predictor.prediction);
+	CHECK(fabs(predictor.frameTime - 42700.0) < 0.005 * 42700.0);
+	// the burst and the grace period of the update trigger
+	CHECK((predictor.readMicro >= 11 + SPIC_HOST_TRIGGER_US) && (predictor.readMicro <= 12 + SPIC_HOST_TRIGGER_US));
+	printf("calibration        update period %u ns, update() %u us, pipeline delay %d us\n",
+		predictor.frameTime, predictor.readMicro, predictor.delayMicro());
+
+	runResult plain = run(sensor, timer, predictor);
+	print("6000 rpm", plain);
+	CHECK(plain.meanPredicted < plain.meanFixed / 4);
+	CHECK(plain.meanPredicted < plain.meanLast / 20);
+	CHECK(plain.maxPredicted < 0.1);
+
+	// the frame counter wraps during a gap of more than 64 update periods
+	sensor.sim.advance(5000000);
+	predictor.update();
+	predictor.update();
+	uint32_t now = 0;
+	timer.elapsedMicro(now);
+	double expected = sensor.sim.angleAt(sensor.sim.now() * 1e-9);
+	double gapError = angleError(predictor.angleAtQ16(now), expected);
+	CHECK(gapError < 0.2);
+	printf("after 5 ms gap     error %.4f deg\n", gapError);
+
+	// the prediction of the sensor is not applied twice
+	sensor.reg.enablePrediction();
+	Tle5012Predictor ahead(sensor, timer);
+	CHECK(ahead.begin() == NO_ERROR);
+	CHECK(ahead.prediction);
+	CHECK(ahead.delayMicro() < 0);
+	runResult predicted = run(sensor, timer, ahead);
+	print("sensor prediction", predicted);
+	CHECK(predicted.meanPredicted < predicted.meanFixed / 4);
+	CHECK(predicted.maxPredicted < 0.15);
+	ahead.prediction = false;
+	runResult twice = run(sensor, timer, ahead);
+	print("applied twice", twice);
+	CHECK(twice.meanPredicted > SPEED_DEG * 42.7e-6 * 0.9);
+
+	uint64_t start = benchNanos();
+	for (uint32_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		benchKeep(predictor.angleAtQ16(now + (n & 0x3F)));
+	}
+	printf("angleAtQ16         %.1f ns\n", (double) (benchNanos() - start) / NUM_ROUNDS);
+
+	return (failed == 0 ? 0 : 1);
+}
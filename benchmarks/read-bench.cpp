@@ -0,0 +1,134 @@
+/**
+ * @file        read-bench.cpp
+ * @brief       Compares the register read paths with and without copies
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Times the former readFromSensor and readMoreRegisters, which zeroed a
+ * 48 word stack buffer and copied the result, against the actual ones and
+ * the zero-copy readBurst on the register file SPIC. Checks that all of
+ * them return the same values. "make stack-usage" prints the stack frame
+ * sizes of the same functions.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.hpp"
+#include "bench-spic.hpp"
+
+#define NUM_ROUNDS    100000
+
+/**
+ * @brief the former read functions, used as reference
+ */
+class LegacyTle5012b: public Tle5012b
+{
+	public:
+
+		__attribute__((noinline)) errorTypes legacyReadFromSensor(uint16_t command, uint16_t &data, updTypes upd, safetyTypes safe)
+		{
+			errorTypes checkError = NO_ERROR;
+
+			_command[0] = READ_SENSOR | command | upd | safe;
+			uint16_t _received[MAX_REGISTER_MEM] = {0};
+			sBus->sendReceive(_command, 1, _received, 2);
+			data = _received[0];
+			if (safe == SAFE_high)
+			{
+				checkError = checkSafety(_received[1], _command[0], &_received[0], 1);
+				if (checkError != NO_ERROR)
+				{
+					data = 0;
+				}
+			}
+			return (checkError);
+		}
+
+		__attribute__((noinline)) errorTypes legacyReadMoreRegisters(uint16_t command, uint16_t data[], updTypes upd, safetyTypes safe)
+		{
+			errorTypes checkError = NO_ERROR;
+
+			_command[0] = READ_SENSOR | command | upd;
+			uint16_t _received[MAX_REGISTER_MEM] = {0};
+			uint16_t _recDataLength = (_command[0] & (0x000F));
+			sBus->sendReceive(_command, 1, _received, _recDataLength + safe);
+			memcpy(data, _received, (_recDataLength)* sizeof(uint16_t));
+			if (safe == SAFE_high)
+			{
+				checkError = checkSafety(_received[_recDataLength], _command[0], _received, _recDataLength);
+			}
+			return (checkError);
+		}
+};
+
+int main()
+{
+	static const uint16_t lengths[] = { 1, 4, 6, 8, 15 };
+	BenchSPIC bus;
+	LegacyTle5012b sensor;
+	uint16_t legacy[MAX_NUM_REG + 1];
+	uint16_t actual[MAX_NUM_REG + 1];
+	uint16_t burst[MAX_NUM_REG + 1];
+	int failed = 0;
+	uint64_t start;
+	double ns[3];
+
+	sensor.sBus = &bus;
+	printf("register read, ns per call\n%-22s %10s %10s %10s\n", "", "former", "actual", "readBurst");
+
+	start = benchNanos();
+	for (uint32_t r = 0; r < NUM_ROUNDS; r++)
+	{
+		failed += (sensor.legacyReadFromSensor(sensor.reg.REG_AVAL, legacy[0], UPD_low, SAFE_high) != NO_ERROR);
+	}
+	ns[0] = (double) (benchNanos() - start) / NUM_ROUNDS;
+	start = benchNanos();
+	for (uint32_t r = 0; r < NUM_ROUNDS; r++)
+	{
+		failed += (sensor.readFromSensor(sensor.reg.REG_AVAL, actual[0], UPD_low, SAFE_high) != NO_ERROR);
+	}
+	ns[1] = (double) (benchNanos() - start) / NUM_ROUNDS;
+	start = benchNanos();
+	for (uint32_t r = 0; r < NUM_ROUNDS; r++)
+	{
+		failed += (sensor.readBurst(sensor.reg.REG_AVAL + 1, burst, 2, UPD_low, SAFE_high) != NO_ERROR);
+	}
+	ns[2] = (double) (benchNanos() - start) / NUM_ROUNDS;
+	failed += (legacy[0] != actual[0]) || (legacy[0] != burst[0]);
+	printf("%-22s %10.1f %10.1f %10.1f\n", "readFromSensor", ns[0], ns[1], ns[2]);
+
+	for (uint8_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+	{
+		uint16_t command = sensor.reg.REG_STAT + lengths[l];
+
+		start = benchNanos();
+		for (uint32_t r = 0; r < NUM_ROUNDS; r++)
+		{
+			failed += (sensor.legacyReadMoreRegisters(command, legacy, UPD_low, SAFE_high) != NO_ERROR);
+		}
+		ns[0] = (double) (benchNanos() - start) / NUM_ROUNDS;
+		start = benchNanos();
+		for (uint32_t r = 0; r < NUM_ROUNDS; r++)
+		{
+			failed += (sensor.readMoreRegisters(command, actual, UPD_low, SAFE_high) != NO_ERROR);
+		}
+		ns[1] = (double) (benchNanos() - start) / NUM_ROUNDS;
+		start = benchNanos();
+		for (uint32_t r = 0; r < NUM_ROUNDS; r++)
+		{
+			failed += (sensor.readBurst(command, burst, lengths[l] + 1, UPD_low, SAFE_high) != NO_ERROR);
+		}
+		ns[2] = (double) (benchNanos() - start) / NUM_ROUNDS;
+		failed += (memcmp(legacy, actual, lengths[l] * sizeof(uint16_t)) != 0);
+		failed += (memcmp(legacy, burst, lengths[l] * sizeof(uint16_t)) != 0);
+		printf("readMoreRegisters %2u  %10.1f %10.1f %10.1f\n", lengths[l], ns[0], ns[1], ns[2]);
+	}
+
+	failed += (sensor.readBurst(sensor.reg.REG_STAT + 4, burst, 4, UPD_low, SAFE_high) != BUFFER_SIZE_ERROR);
+	if (failed != 0)
+	{
+		printf("FAILED: %d errors or mismatches between the read functions\n", failed);
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,202 @@
+/**
+ * @file        ring-bench.cpp
+ * @brief       Two thread stress test of the sample ring buffer
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * A producer thread pushes numbered records while a consumer thread pops
+ * them in batches, first with a producer that retries on a full ring to
+ * measure the throughput, then with a small ring and a slow consumer,
+ * where the producer pushes in bursts and full pushes are dropped, so drops
+ * and pops take turns. The consumer checks that the records
+ * arrive complete and in order, and that every record is either received
+ * or counted as overrun. Prints the throughput and the overruns. Also
+ * fills the ring from the simulated sensor through the sampler.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <thread>
+#include "bench.hpp"
+#include "corelib/tle5012b_ring.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_RECORDS    2000000UL
+#define BATCH_SIZE     32
+#define DROP_BURST     100           /**< pushes between two yields of the producer, more than the small ring holds */
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Record with all fields derived from its number
+ */
+static ringSample makeRecord(uint32_t n)
+{
+	ringSample r;
+	r.timestamp = n;
+	r.rawAngle = (int16_t) (n & 0x3FFF);
+	r.rawSpeed = (int16_t) -(int16_t) (n & 0x3FFF);
+	r.revolutions = (int16_t) ((n >> 14) & 0xFF);
+	r.safety = (uint16_t) (0x7000 | (n & 0xFF));
+	r.frameCounter = (uint8_t) (n & 0x3F);
+	r.status = NO_ERROR;
+	r.reserved = 0;
+	return (r);
+}
+
+static bool isValid(const ringSample &r)
+{
+	ringSample expected = makeRecord(r.timestamp);
+	return ((r.rawAngle == expected.rawAngle) && (r.rawSpeed == expected.rawSpeed)
+		&& (r.revolutions == expected.revolutions) && (r.safety == expected.safety)
+		&& (r.frameCounter == expected.frameCounter));
+}
+
+/**
+ * @brief Result of one stress run
+ */
+struct stressResult
+{
+	uint32_t received;
+	uint32_t pushed;
+	uint32_t overruns;
+	uint32_t corrupt;
+	uint32_t disorder;
+	double   seconds;
+};
+
+/**
+ * @brief Runs a producer and a consumer thread on one ring
+ * @param consumerDelayNs spin of the consumer after each batch
+ * @param retry the producer retries a full push instead of dropping the record
+ * @param burst pushes after which the producer yields, 0 for never
+ */
+template<uint16_t SIZE>
+static stressResult stress(uint32_t consumerDelayNs, bool retry, uint32_t burst)
+{
+	static Tle5012Ring<SIZE> ring;
+	stressResult result = { 0, 0, 0, 0, 0, 0.0 };
+	volatile bool done = false;
+
+	uint64_t start = benchNanos();
+	std::thread consumer([&]() {
+		ringSample batch[BATCH_SIZE];
+		int64_t last = -1;
+		while (true)
+		{
+			bool finished = __atomic_load_n(&done, __ATOMIC_ACQUIRE);
+			uint16_t count = ring.popBatch(batch, BATCH_SIZE);
+			for (uint16_t i = 0; i < count; i++)
+			{
+				result.corrupt += isValid(batch[i]) ? 0 : 1;
+				result.disorder += ((int64_t) batch[i].timestamp > last) ? 0 : 1;
+				last = batch[i].timestamp;
+			}
+			result.received += count;
+			if (consumerDelayNs > 0)
+			{
+				uint64_t until = benchNanos() + consumerDelayNs;
+				while (benchNanos() < until)
+				{
+				}
+			}
+			if (count == 0)
+			{
+				if (finished)
+				{
+					break;
+				}
+				std::this_thread::yield();
+			}
+		}
+	});
+	for (uint32_t n = 0; n < NUM_RECORDS; n++)
+	{
+		ringSample record = makeRecord(n);
+		bool pushed = ring.push(record);
+		while (!pushed && retry)
+		{
+			std::this_thread::yield();
+			pushed = ring.push(record);
+		}
+		result.pushed += pushed ? 1 : 0;
+		if ((burst > 0) && ((n % burst) == burst - 1))
+		{
+			std::this_thread::yield();
+		}
+	}
+	__atomic_store_n(&done, true, __ATOMIC_RELEASE);
+	consumer.join();
+	result.seconds = (benchNanos() - start) * 1e-9;
+	result.overruns = ring.overruns();
+	return (result);
+}
+
+/**
+ * @brief Sampler read of the motion snapshot
+ */
+static errorTypes readSnapshot(Tle5012b &sensor, int32_t &value, void *context)
+{
+	Tle5012b::motionSnapshot *snapshot = (Tle5012b::motionSnapshot *) context;
+	errorTypes status = sensor.readMotionSnapshot(*snapshot);
+	value = snapshot->rawAngle;
+	return (status);
+}
+
+int main()
+{
+	int failed = 0;
+
+	stressResult fast = stress<4096>(0, true, 0);
+	stressResult slow = stress<64>(2000, false, DROP_BURST);
+	const char *names[] = { "ring 4096, retry", "ring 64, drop" };
+	stressResult *results[] = { &fast, &slow };
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		stressResult &r = *results[i];
+		printf("%-18s %8u received, %8u full pushes, %.1f M records/s\n",
+			names[i], r.received, r.overruns, r.received / r.seconds * 1e-6);
+		CHECK(r.received == r.pushed);
+		CHECK(r.corrupt == 0);
+		CHECK(r.disorder == 0);
+	}
+	CHECK(fast.received == NUM_RECORDS);
+	CHECK(slow.received + slow.overruns == NUM_RECORDS);
+	CHECK(slow.overruns >= NUM_RECORDS / 100);
+	CHECK(slow.received >= NUM_RECORDS / 100);
+	printf("record size        %u bytes, ring 64 uses %u bytes\n",
+		(unsigned) sizeof(ringSample), (unsigned) sizeof(Tle5012Ring<64>));
+
+	// sampler to ring on the simulated sensor
+	Tle5012Host sensor;
+	TimerHost timer(&sensor.sim);
+	Tle5012Sampler sampler(sensor, timer);
+	Tle5012b::motionSnapshot snapshot;
+	sampler.setRead(readSnapshot, &snapshot);
+	static Tle5012Ring<16> ring;
+	ringSample batch[16];
+	CHECK(sensor.begin() == NO_ERROR);
+	sensor.sim.setTrajectory(0.0, 720.0);
+	sampler.begin(1000);
+	Tle5012Sampler::sample s;
+	for (uint8_t n = 0; n < 20; n++)
+	{
+		errorTypes status = sampler.next(s);
+		ringSample r;
+		r.set(snapshot, sensor.safetyWord, status, s.time);
+		ring.push(r);
+	}
+	CHECK(ring.available() == 16);
+	CHECK(ring.overruns() == 4);
+	uint16_t count = ring.popBatch(batch, 16);
+	CHECK(count == 16);
+	for (uint16_t i = 1; i < count; i++)
+	{
+		CHECK(batch[i].timestamp == batch[i - 1].timestamp + 1000);
+		CHECK(batch[i].rawAngle > batch[i - 1].rawAngle);
+		CHECK(batch[i].status == NO_ERROR);
+	}
+	CHECK(ring.available() == 0);
+
+	return (failed == 0 ? 0 : 1);
+}
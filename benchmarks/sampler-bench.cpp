@@ -0,0 +1,139 @@
+/**
+ * @file        sampler-bench.cpp
+ * @brief       Checks the fixed rate sampler on the model clock and the monotonic clock
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * On the model clock of the simulated sensor the sampler must hit the grid
+ * exactly, report the bus time as read latency and skip whole periods
+ * after a slow read without shifting the grid. On the monotonic clock it
+ * runs against the simulated bus in real time and is compared with a loop
+ * which just delays one period after each read. Prints the jitter and
+ * latency statistics and the drift of both.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "bench.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_SAMPLES    1000
+#define PERIOD_US      1000
+#define REAL_SAMPLES   300
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Context of the slow read
+ */
+struct slowContext
+{
+	Tle5012Sim *sim;
+	uint32_t    calls;
+};
+
+/**
+ * @brief Angle read which stalls for 2.5 periods every 100th sample
+ */
+static errorTypes slowRead(Tle5012b &sensor, int32_t &value, void *context)
+{
+	slowContext *slow = (slowContext *) context;
+	if ((++slow->calls % 100) == 0)
+	{
+		slow->sim->advance(2500 * PERIOD_US);
+	}
+	return (sensor.getAngleQ16(value));
+}
+
+static void printStats(const char *name, samplerStats &stats)
+{
+	printf("%-18s min %5d max %5d mean %5d p99 %5u us\n", name, stats.min, stats.max, stats.mean(), stats.percentile(99));
+}
+
+int main()
+{
+	Tle5012Host sensor;
+	int failed = 0;
+	Tle5012Sampler::sample s;
+
+	CHECK(sensor.begin() == NO_ERROR);
+	sensor.sim.setTrajectory(0.0, 100.0);
+
+	// model clock, exact grid
+	TimerHost modelTimer(&sensor.sim);
+	Tle5012Sampler sampler(sensor, modelTimer);
+	sampler.begin(PERIOD_US);
+	uint64_t start = sensor.sim.now();
+	uint32_t errors = 0;
+	double angleMaxError = 0;
+	for (uint32_t n = 0; n < NUM_SAMPLES; n++)
+	{
+		errors += (sampler.next(s) != NO_ERROR) ? 1 : 0;
+		CHECK(s.index == n);
+		CHECK(s.time == n * PERIOD_US);
+		double expected = fmod(sensor.sim.angleAt((start + s.time * 1000ULL) * 1e-9), 360.0);
+		double angle = fmod(s.value * (360.0 / 65536.0) + 360.0, 360.0);
+		angleMaxError = fmax(angleMaxError, fabs(angle - expected));
+	}
+	CHECK(errors == 0);
+	CHECK((sampler.jitter.min == 0) && (sampler.jitter.max == 0));
+	CHECK(sampler.jitter.count == NUM_SAMPLES - 1);
+	CHECK((sampler.latency.min >= 53) && (sampler.latency.max <= 54));
+	CHECK(sampler.missed == 0);
+	CHECK(angleMaxError < 0.02);
+	printf("model clock        %u samples, max angle error %.4f deg\n", NUM_SAMPLES, angleMaxError);
+	printStats("  jitter", sampler.jitter);
+	printStats("  latency", sampler.latency);
+
+	// slow reads skip periods, the grid stays
+	slowContext slow = { &sensor.sim, 0 };
+	sampler.setRead(slowRead, &slow);
+	sampler.begin(PERIOD_US);
+	uint32_t lastIndex = 0;
+	for (uint32_t n = 0; n < NUM_SAMPLES; n++)
+	{
+		sampler.next(s);
+		CHECK((n == 0) || (s.index > lastIndex));
+		CHECK((s.time - s.index * PERIOD_US) < PERIOD_US);
+		lastIndex = s.index;
+	}
+	// each stall ends 1.5 periods after the next slot, which is skipped
+	CHECK(sampler.missed == (NUM_SAMPLES - 1) / 100);
+	CHECK(s.index == NUM_SAMPLES - 1 + sampler.missed);
+	printf("slow reads         %u samples, %u periods missed, last sample %u us behind its slot\n",
+		NUM_SAMPLES, sampler.missed, s.time - s.index * PERIOD_US);
+	sampler.setRead(NULL, NULL);
+
+	// monotonic clock against the simulated bus
+	TimerHost clock;
+	Tle5012Sampler realtime(sensor, clock);
+	realtime.begin(PERIOD_US, 5);
+	for (uint32_t n = 0; n < REAL_SAMPLES; n++)
+	{
+		realtime.next(s);
+	}
+	int64_t drift = (int64_t) s.time - (int64_t) s.index * PERIOD_US;
+	printf("monotonic clock    %u samples, %u missed, drift of the last sample %lld us\n",
+		REAL_SAMPLES, realtime.missed, (long long) drift);
+	printStats("  jitter", realtime.jitter);
+	printStats("  latency", realtime.latency);
+	CHECK(drift < PERIOD_US);
+
+	// the delay loop drifts with every read
+	uint32_t loopStart = 0;
+	uint32_t loopEnd = 0;
+	int32_t value = 0;
+	clock.start();
+	clock.elapsedMicro(loopStart);
+	for (uint32_t n = 0; n < REAL_SAMPLES; n++)
+	{
+		sensor.getAngleQ16(value);
+		clock.delayMicro(PERIOD_US);
+	}
+	clock.elapsedMicro(loopEnd);
+	printf("delay loop         %u samples, drift %d us\n", REAL_SAMPLES,
+		(int32_t) (loopEnd - loopStart) - REAL_SAMPLES * PERIOD_US);
+
+	return (failed == 0 ? 0 : 1);
+}
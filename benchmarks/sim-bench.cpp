@@ -0,0 +1,171 @@
+/**
+ * @file        sim-bench.cpp
+ * @brief       Runs the TLE5012B library against the simulated sensor of the host framework
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Starts a Tle5012Host like a sketch and checks that the library sees the
+ * magnet trajectory of the model: angle, speed with and without prediction,
+ * revolutions and temperature, the RESP bits of the slave number, the
+ * coherent UPD snapshot, the FCNT frame counter, CRC errors and that
+ * CRC_PAR stays valid after configuration writes. Prints the bus time of
+ * the common get functions at the model SPI clock.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include "bench.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_ROUNDS    1000
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Angle difference wrapped to -180° .. 180°
+ */
+static double angleDiff(double a, double b)
+{
+	double diff = fmod(a - b, 360.0);
+	if (diff > 180.0)
+	{
+		diff -= 360.0;
+	}else if (diff < -180.0)
+	{
+		diff += 360.0;
+	}
+	return (diff);
+}
+
+int main()
+{
+	Tle5012Host sensor;
+	int failed = 0;
+	errorTypes status;
+
+	status = sensor.begin();
+	CHECK(status == NO_ERROR);
+	CHECK(sensor.sim.isCrcParValid());
+
+	// angle follows the magnet within one update period and the transfer time
+	const double speed = 20000.0;
+	sensor.sim.setTrajectory(10.0, speed);
+	double angleMaxError = 0;
+	uint64_t transferTime = 0;
+	for (uint16_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		double angle = 0;
+		sensor.sim.advance(37000);
+		uint64_t start = sensor.sim.now();
+		status = sensor.getAngleValue(angle);
+		CHECK(status == NO_ERROR);
+		transferTime = sensor.sim.now() - start;
+		angleMaxError = fmax(angleMaxError, fabs(angleDiff(angle, sensor.sim.angleAt(start * 1e-9))));
+	}
+	double periodAngle = speed * (sensor.sim.updatePeriod() + transferTime) * 1e-9;
+	printf("angle              %u reads, max error %.4f deg, update period and transfer %.4f deg\n", NUM_ROUNDS, angleMaxError, periodAngle);
+	CHECK(angleMaxError <= periodAngle + 0.02);
+
+	// speed without and with prediction
+	double angleSpeed = 0;
+	status = sensor.getAngleSpeed(angleSpeed);
+	CHECK(status == NO_ERROR);
+	printf("speed              %.1f deg/s for %.1f deg/s\n", angleSpeed, speed);
+	CHECK(fabs(angleSpeed - speed) <= speed * 0.01);
+	sensor.reg.enablePrediction();
+	sensor.sim.advance(500000);
+	status = sensor.getAngleSpeed(angleSpeed);
+	CHECK(status == NO_ERROR);
+	printf("speed prediction  %.1f deg/s for %.1f deg/s\n", angleSpeed, speed);
+	CHECK(fabs(angleSpeed - speed) <= speed * 0.01);
+	CHECK(sensor.sim.isCrcParValid());
+	sensor.reg.disablePrediction();
+	CHECK(sensor.sim.isCrcParValid());
+
+	// revolutions after 50 ms at 20000 deg/s, about five turns
+	int16_t revolutions = 0;
+	sensor.sim.setTrajectory(10.0, speed);
+	sensor.sim.advance(50000000);
+	status = sensor.getNumRevolutions(revolutions);
+	CHECK(status == NO_ERROR);
+	double magnet = sensor.sim.angleAt(sensor.sim.now() * 1e-9);
+	printf("revolutions        %d at %.1f deg\n", revolutions, magnet);
+	CHECK(revolutions == (int16_t) floor((magnet + 180.0) / 360.0));
+
+	// temperature
+	double temperature = 0;
+	sensor.sim.setTemperature(60.0);
+	sensor.sim.advance(200000);
+	status = sensor.getTemperature(temperature);
+	CHECK(status == NO_ERROR);
+	printf("temperature        %.2f degC for 60.00 degC\n", temperature);
+	CHECK(fabs(temperature - 60.0) <= 0.5 / TEMP_DIV);
+
+	// UPD snapshot stays coherent while the live registers move on
+	Tle5012b::motionSnapshot first;
+	Tle5012b::motionSnapshot second;
+	sensor.sBus->triggerUpdate();
+	uint64_t snapStart = sensor.sim.now();
+	status = sensor.readMotionSnapshot(first, UPD_high);
+	CHECK(status == NO_ERROR);
+	sensor.sim.advance(10 * sensor.sim.updatePeriod());
+	status = sensor.readMotionSnapshot(second, UPD_high);
+	CHECK(status == NO_ERROR);
+	CHECK(first.rawAngle == second.rawAngle);
+	CHECK(first.rawSpeed == second.rawSpeed);
+	CHECK(first.frameCounter == second.frameCounter);
+	status = sensor.readMotionSnapshot(second, UPD_low);
+	CHECK(status == NO_ERROR);
+	CHECK(first.rawAngle != second.rawAngle);
+	// the reads add their bus time in update periods
+	uint8_t passed = (second.frameCounter - first.frameCounter) & 0x3F;
+	uint32_t readPeriods = (uint32_t) ((sensor.sim.now() - snapStart) / sensor.sim.updatePeriod()) - 10;
+	printf("frame counter      %u -> %u after 10 update periods and the reads\n", first.frameCounter, second.frameCounter);
+	CHECK((passed >= 10) && (passed <= 11 + readPeriods));
+
+	// slave number and RESP bits
+	Tle5012Host slave(Tle5012b::TLE5012B_S2);
+	status = slave.begin();
+	CHECK(status == NO_ERROR);
+	status = slave.getAngleValue(magnet);
+	CHECK(status == NO_ERROR);
+	slave.safetyStatus.fetch_Safety(slave.safetyWord);
+	CHECK(slave.safetyStatus.responseSlave() == Tle5012b::TLE5012B_S2);
+
+	// a corrupted safety word is reported
+	sensor.sim.injectCrcError(1);
+	status = sensor.getAngleValue(magnet);
+	CHECK(status == CRC_ERROR);
+	status = sensor.getAngleValue(magnet);
+	CHECK(status == NO_ERROR);
+
+	// CRC_PAR after configuration writes
+	sensor.reg.setAngleRange(Reg::factor1);
+	status = sensor.writeOffsetX(0x0120);
+	CHECK(status == NO_ERROR);
+	status = sensor.readBlockCRC();
+	CHECK(status == NO_ERROR);
+	CHECK(sensor.sim.isCrcParValid());
+
+	// bus time at the model SPI clock
+	int16_t rawAngle = 0;
+	uint64_t start = sensor.sim.now();
+	uint64_t words = sensor.sim.words;
+	for (uint16_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		sensor.getAngleValue(magnet, rawAngle);
+	}
+	printf("getAngleValue      %.1f words, %.0f ns bus time per call\n",
+		(double) (sensor.sim.words - words) / NUM_ROUNDS, (double) (sensor.sim.now() - start) / NUM_ROUNDS);
+	start = sensor.sim.now();
+	words = sensor.sim.words;
+	for (uint16_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		sensor.readMotionSnapshot(first);
+	}
+	printf("readMotionSnapshot %.1f words, %.0f ns bus time per call\n",
+		(double) (sensor.sim.words - words) / NUM_ROUNDS, (double) (sensor.sim.now() - start) / NUM_ROUNDS);
+
+	return (failed == 0 ? 0 : 1);
+}
@@ -0,0 +1,171 @@
+/**
+ * @file        stats-bench.cpp
+ * @brief       Checks the SPIC bus instrumentation and measures its overhead
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Runs the library through SPICStats on the simulated sensor with the model
+ * clock as timer and checks the counters of the registers, the transfer
+ * time histogram, the attribution of CRC and STAT errors and the counts of
+ * the commands of a command list. Prints the per register counters and the
+ * time per getAngleValue with and without the instrumentation on the
+ * register file SPIC.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.hpp"
+#include "bench-spic.hpp"
+#include "pal/spic-stats.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_ROUNDS    1000
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief ns per getAngleValue on a bus
+ */
+static double timeAngle(SPIC &bus)
+{
+	Tle5012b sensor;
+	double angle = 0;
+	sensor.sBus = &bus;
+	uint64_t start = benchNanos();
+	for (uint32_t n = 0; n < NUM_ROUNDS * 100; n++)
+	{
+		sensor.getAngleValue(angle);
+		benchKeep(angle);
+	}
+	return ((double) (benchNanos() - start) / (NUM_ROUNDS * 100));
+}
+
+int main()
+{
+	Tle5012Host sensor;
+	TimerHost timer(&sensor.sim);
+	SPICStats stats(&sensor.bus, &timer);
+	int failed = 0;
+	errorTypes status;
+	double angle = 0;
+
+	sensor.sBus = &stats;
+	status = sensor.begin();
+	CHECK(status == NO_ERROR);
+	stats.reset();
+
+	// one transfer of 1 + 2 words per angle read, 53.5 us at 1 MHz with the turnaround
+	sensor.sim.setTrajectory(0.0, 1000.0);
+	for (uint16_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		status = sensor.getAngleValue(angle);
+		CHECK(status == NO_ERROR);
+	}
+	SPICStats::regStats &aval = stats.registerStats(0x02);
+	CHECK(aval.transfers == NUM_ROUNDS);
+	CHECK(aval.wordsSent == NUM_ROUNDS);
+	CHECK(aval.wordsReceived == 2 * NUM_ROUNDS);
+	CHECK((aval.timeMicro >= 53 * NUM_ROUNDS) && (aval.timeMicro <= 54 * NUM_ROUNDS));
+	CHECK(aval.histogram[6] == NUM_ROUNDS);
+	CHECK((aval.crcErrors == 0) && (aval.safetyErrors == 0));
+
+	// errors are counted on the register of the transfer
+	sensor.sim.injectCrcError(1);
+	status = sensor.getAngleValue(angle);
+	CHECK(status == CRC_ERROR);
+	CHECK(aval.crcErrors == 1);
+	int16_t revolutions = 0;
+	sensor.sim.injectSystemError();
+	status = sensor.getNumRevolutions(revolutions);
+	CHECK(status == SYSTEM_ERROR);
+	CHECK(stats.registerStats(0x04).safetyErrors == 1);
+	CHECK(stats.registerStats(0x04).crcErrors == 0);
+
+	// writes and the CRC update
+	sensor.reg.enablePrediction();
+	CHECK(stats.registerStats(0x08).transfers > 0);
+	CHECK(stats.registerStats(0x0F).transfers > 0);
+	CHECK(stats.registerStats(0x0F).crcErrors == 0);
+
+	// each command of a list is counted on its register, with its share of the list time
+	SPICStats::regStats &t25o = stats.registerStats(0x30);
+	uint32_t avalTransfers = aval.transfers;
+	uint32_t avalTime = aval.timeMicro;
+	uint64_t listWords = sensor.sim.words;
+	sensor.bus.setupTime = 2000;
+	uint64_t listStart = sensor.sim.now();
+	status = sensor.readRegisters(Reg::MASK_AVAL | Reg::MASK_T25O);
+	CHECK(status == NO_ERROR);
+	uint64_t listNs = sensor.sim.now() - listStart;
+	uint32_t listTime = (uint32_t) (listNs / 1000);
+	CHECK(aval.transfers == avalTransfers + 1);
+	CHECK(t25o.transfers == 1);
+	CHECK(t25o.wordsSent + t25o.wordsReceived + 3 == sensor.sim.words - listWords);
+	uint32_t shared = (aval.timeMicro - avalTime) + t25o.timeMicro;
+	CHECK((shared <= listTime) && (shared + 2 >= listTime));
+	// the list runs as one transaction of the host bus, which sets up once
+	sensor.sBus = &sensor.bus;
+	listStart = sensor.sim.now();
+	status = sensor.readRegisters(Reg::MASK_AVAL | Reg::MASK_T25O);
+	CHECK(status == NO_ERROR);
+	CHECK(sensor.sim.now() - listStart == listNs);
+	sensor.sBus = &stats;
+	sensor.bus.setupTime = 0;
+	sensor.sim.injectCrcError(1);
+	status = sensor.readRegisters(Reg::MASK_AVAL | Reg::MASK_T25O);
+	CHECK(status == CRC_ERROR);
+	CHECK(aval.crcErrors == 2);
+	CHECK(t25o.crcErrors == 0);
+
+	// an unknown address goes to the last entry
+	uint16_t data = 0;
+	sensor.readFromSensor(0x0130, data);
+	CHECK(stats.regs[MAX_NUM_REG].transfers == 1);
+	CHECK(stats.regs[MAX_NUM_REG].safetyErrors == 1);
+
+	SPICStats::regStats total;
+	stats.total(total);
+	uint32_t histogram = 0;
+	for (uint8_t b = 0; b < TLE5012_SPIC_STATS_BUCKETS; b++)
+	{
+		histogram += total.histogram[b];
+	}
+	CHECK(histogram == total.transfers);
+
+	printf("register  transfers  words out  words in    time us  crc  stat  histogram 2^n us\n");
+	for (uint8_t i = 0; i < SPIC_STATS_ENTRIES; i++)
+	{
+		SPICStats::regStats &r = stats.regs[i];
+		if (r.transfers == 0)
+		{
+			continue;
+		}
+		if (i < MAX_NUM_REG)
+		{
+			printf("%02Xh      ", Reg::addrFields[i].regAddress >> 4);
+		}else{
+			printf("other    ");
+		}
+		printf("%10u %10u %9u %10u %4u %5u ", r.transfers, r.wordsSent, r.wordsReceived, r.timeMicro, r.crcErrors, r.safetyErrors);
+		for (uint8_t b = 0; b < TLE5012_SPIC_STATS_BUCKETS; b++)
+		{
+			printf(" %u", r.histogram[b]);
+		}
+		printf("\n");
+	}
+	printf("total    %10u %10u %9u %10u %4u %5u\n", total.transfers, total.wordsSent, total.wordsReceived,
+		total.timeMicro, total.crcErrors, total.safetyErrors);
+
+	// overhead on the register file SPIC
+	BenchSPIC plain;
+	BenchSPIC counted;
+	BenchSPIC timed;
+	TimerHost clock;
+	SPICStats counter(&counted);
+	SPICStats timedCounter(&timed, &clock);
+	timedCounter.init();
+	printf("getAngleValue ns   plain %.1f, counted %.1f, counted and timed %.1f\n",
+		timeAngle(plain), timeAngle(counter), timeAngle(timedCounter));
+
+	return (failed == 0 ? 0 : 1);
+}
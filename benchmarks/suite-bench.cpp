@@ -0,0 +1,219 @@
+/**
+ * @file        suite-bench.cpp
+ * @brief       Benchmark suite for the hot paths of the TLE5012B core library
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Times the get functions, readRegMap, regularCrcUpdate, checkSafety and
+ * the Reg bit field accessors on the register file SPIC and reports the
+ * time, the 16 bit SPI words and the chip select cycles per operation.
+ * Prints a table, or with --json a JSON document to track regressions
+ * between releases, e.g. "make json".
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+#include "bench.hpp"
+#include "bench-spic.hpp"
+
+#define SUITE_NAME       "tle5012b-corelib"
+#ifndef SUITE_VERSION
+#define SUITE_VERSION    "unknown"       /**< library.properties version, set by the Makefile */
+#endif
+#define NUM_ROUNDS       100000
+
+/**
+ * @brief gives the benchmark access to the protected CRC functions
+ */
+class SuiteTle5012b: public Tle5012b
+{
+	public:
+
+		using Tle5012b::regularCrcUpdate;
+		using Tle5012b::checkSafety;
+};
+
+/**
+ * @brief Context of one benchmark operation
+ */
+struct suiteContext
+{
+	BenchSPIC      bus;
+	SuiteTle5012b  sensor;
+	uint16_t       command;      //!< \brief command word of the checkSafety data
+	uint16_t       data[4];      //!< \brief checkSafety data words
+	uint16_t       safety;       //!< \brief valid safety word of the checkSafety data
+};
+
+typedef errorTypes (*suiteOp_t)(suiteContext &ctx);
+
+/**
+ * @brief One entry of the suite
+ */
+struct suiteEntry
+{
+	const char *name;
+	suiteOp_t   op;
+	uint32_t    rounds;
+};
+
+/**
+ * @brief Result of one entry
+ */
+struct suiteResult
+{
+	double   nsPerOp;
+	double   wordsPerOp;
+	double   transfersPerOp;
+	uint32_t errors;
+};
+
+static errorTypes opGetAngleValue(suiteContext &ctx)
+{
+	double angle = 0;
+	errorTypes status = ctx.sensor.getAngleValue(angle);
+	benchKeep(angle);
+	return (status);
+}
+
+static errorTypes opGetAngleSpeed(suiteContext &ctx)
+{
+	double speed = 0;
+	errorTypes status = ctx.sensor.getAngleSpeed(speed);
+	benchKeep(speed);
+	return (status);
+}
+
+static errorTypes opGetNumRevolutions(suiteContext &ctx)
+{
+	int16_t revolutions = 0;
+	errorTypes status = ctx.sensor.getNumRevolutions(revolutions);
+	benchKeep(revolutions);
+	return (status);
+}
+
+static errorTypes opGetTemperature(suiteContext &ctx)
+{
+	double temperature = 0;
+	errorTypes status = ctx.sensor.getTemperature(temperature);
+	benchKeep(temperature);
+	return (status);
+}
+
+static errorTypes opReadRegMap(suiteContext &ctx)
+{
+	return (ctx.sensor.readRegMap());
+}
+
+static errorTypes opRegularCrcUpdate(suiteContext &ctx)
+{
+	return (ctx.sensor.regularCrcUpdate());
+}
+
+static errorTypes opCheckSafety(suiteContext &ctx)
+{
+	return (ctx.sensor.checkSafety(ctx.safety, ctx.command, ctx.data, 4));
+}
+
+static errorTypes opRegConfigFields(suiteContext &ctx)
+{
+	uint32_t fields = ctx.sensor.reg.getFIRUpdateRate() + ctx.sensor.reg.getAngleRange()
+		+ ctx.sensor.reg.getInterfaceMode() + ctx.sensor.reg.getOffsetX() + ctx.sensor.reg.getCRCpar();
+	benchKeep(fields);
+	return (NO_ERROR);
+}
+
+static errorTypes opRegValueFields(suiteContext &ctx)
+{
+	uint32_t fields = ctx.sensor.reg.getAngleValue() + ctx.sensor.reg.getSpeedValue()
+		+ ctx.sensor.reg.getNumberOfRevolutions() + ctx.sensor.reg.getTemperatureValue();
+	benchKeep(fields);
+	return (NO_ERROR);
+}
+
+static const suiteEntry suite[] = {
+	{ "getAngleValue",       opGetAngleValue,     NUM_ROUNDS },
+	{ "getAngleSpeed",       opGetAngleSpeed,     NUM_ROUNDS },
+	{ "getNumRevolutions",   opGetNumRevolutions, NUM_ROUNDS },
+	{ "getTemperature",      opGetTemperature,    NUM_ROUNDS },
+	{ "readRegMap",          opReadRegMap,        NUM_ROUNDS / 10 },
+	{ "regularCrcUpdate",    opRegularCrcUpdate,  NUM_ROUNDS / 10 },
+	{ "checkSafety",         opCheckSafety,       NUM_ROUNDS },
+	{ "Reg config fields",   opRegConfigFields,   NUM_ROUNDS },
+	{ "Reg value fields",    opRegValueFields,    NUM_ROUNDS }
+};
+
+#define NUM_ENTRIES    (sizeof(suite) / sizeof(suite[0]))
+
+/**
+ * @brief Runs one entry, once to warm up the caches and then timed
+ */
+static suiteResult runEntry(suiteContext &ctx, const suiteEntry &entry)
+{
+	suiteResult result;
+	result.errors = (entry.op(ctx) != NO_ERROR) ? 1 : 0;
+
+	uint32_t words = ctx.bus.words;
+	uint32_t transfers = ctx.bus.transfers;
+	uint64_t start = benchNanos();
+	for (uint32_t n = 0; n < entry.rounds; n++)
+	{
+		if (entry.op(ctx) != NO_ERROR)
+		{
+			result.errors++;
+		}
+	}
+	result.nsPerOp = (double) (benchNanos() - start) / entry.rounds;
+	result.wordsPerOp = (double) (ctx.bus.words - words) / entry.rounds;
+	result.transfersPerOp = (double) (ctx.bus.transfers - transfers) / entry.rounds;
+	return (result);
+}
+
+int main(int argc, char *argv[])
+{
+	static suiteContext ctx;
+	suiteResult results[NUM_ENTRIES];
+	bool json = (argc > 1) && (strcmp(argv[1], "--json") == 0);
+	int failed = 0;
+
+	ctx.sensor.sBus = &ctx.bus;
+	ctx.command = READ_SENSOR | 0x0024;
+	for (uint16_t i = 0; i < 4; i++)
+	{
+		ctx.data[i] = ctx.bus.regs[0x02 + i];
+	}
+	ctx.safety = (uint16_t) (0x7E00 | crc8Words(ctx.command, ctx.data, 4));
+
+	for (uint8_t i = 0; i < NUM_ENTRIES; i++)
+	{
+		results[i] = runEntry(ctx, suite[i]);
+		if (results[i].errors != 0)
+		{
+			fprintf(stderr, "FAILED: %s returned %u errors\n", suite[i].name, results[i].errors);
+			failed++;
+		}
+	}
+
+	if (json)
+	{
+		printf("{\n  \"suite\": \"%s\",\n  \"version\": \"%s\",\n  \"bus\": \"register file SPIC\",\n  \"benchmarks\": [\n",
+			SUITE_NAME, SUITE_VERSION);
+		for (uint8_t i = 0; i < NUM_ENTRIES; i++)
+		{
+			printf("    { \"name\": \"%s\", \"rounds\": %u, \"ns_per_op\": %.2f, \"words_per_op\": %.2f, \"cs_per_op\": %.2f, \"errors\": %u }%s\n",
+				suite[i].name, suite[i].rounds, results[i].nsPerOp, results[i].wordsPerOp,
+				results[i].transfersPerOp, results[i].errors, (i < NUM_ENTRIES - 1) ? "," : "");
+		}
+		printf("  ]\n}\n");
+	}else{
+		printf("%-20s %10s %10s %10s\n", "operation", "ns/op", "words/op", "cs/op");
+		for (uint8_t i = 0; i < NUM_ENTRIES; i++)
+		{
+			printf("%-20s %10.1f %10.2f %10.2f\n", suite[i].name, results[i].nsPerOp,
+				results[i].wordsPerOp, results[i].transfersPerOp);
+		}
+	}
+
+	return (failed == 0 ? 0 : 1);
+}
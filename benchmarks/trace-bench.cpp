@@ -0,0 +1,222 @@
+/**
+ * @file        trace-bench.cpp
+ * @brief       Records the traffic to the simulated sensor and replays it
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Runs a control loop like workload against the simulated sensor through
+ * SPICTrace, writes the trace to a file, reads it back and replays it into
+ * a new Tle5012b with SPICReplay. The replay must give the same values and
+ * error codes without mismatches, also for the command lists and for two
+ * sensors sharing one trace.
+ * A driver talking differently to the sensor must show mismatches. Prints
+ * the trace size and the time per workload round on the model and on the
+ * replay bus.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+#include "bench.hpp"
+#include "pal/spic-trace.hpp"
+#include "framework/host/wrapper/TLE5012-platf-host.hpp"
+
+#define NUM_ROUNDS    500
+#define TRACE_SIZE    (256 * 1024)
+#define TRACE_FILE    "build/trace-bench.bin"
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+/**
+ * @brief Trace in memory
+ */
+struct traceBuffer
+{
+	uint8_t  data[TRACE_SIZE];
+	uint32_t length;
+};
+
+static void memorySink(const uint8_t *data, uint16_t length, void *context)
+{
+	traceBuffer *buffer = (traceBuffer *) context;
+	if (buffer->length + length <= TRACE_SIZE)
+	{
+		memcpy(&buffer->data[buffer->length], data, length);
+		buffer->length += length;
+	}
+}
+
+/**
+ * @brief Results of one workload round
+ */
+struct roundResult
+{
+	int32_t    angleQ16;
+	int32_t    speedCdeg;
+	int16_t    revolutions;
+	int32_t    temperatureQ8;
+	uint8_t    status;
+};
+
+/**
+ * @brief Control loop workload, the same transfers for recording and replay
+ */
+static void workload(Tle5012b &sensor, roundResult results[], Tle5012Sim *sim)
+{
+	sensor.writeSlaveNumber(sensor.mSlave);
+	sensor.readBlockCRC();
+	for (uint16_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		roundResult &r = results[n];
+		uint8_t status = 0;
+		if (sim != NULL)
+		{
+			sim->advance(100000);
+			if (n == NUM_ROUNDS / 2)
+			{
+				sim->injectCrcError(1);
+			}
+		}
+		status |= sensor.getAngleQ16(r.angleQ16);
+		status |= sensor.getAngleSpeedCdeg(r.speedCdeg);
+		if ((n % 10) == 0)
+		{
+			status |= sensor.getNumRevolutions(r.revolutions);
+			status |= sensor.getTemperatureQ8(r.temperatureQ8);
+			// a command list of two bursts
+			status |= sensor.readRegisters(Reg::MASK_AVAL | Reg::MASK_T25O);
+		}else{
+			r.revolutions = 0;
+			r.temperatureQ8 = 0;
+		}
+		if (n == NUM_ROUNDS / 4)
+		{
+			sensor.reg.enablePrediction();
+		}
+		r.status = status;
+	}
+}
+
+int main()
+{
+	static traceBuffer recorded;
+	static traceBuffer loaded;
+	static roundResult live[NUM_ROUNDS];
+	static roundResult replayed[NUM_ROUNDS];
+	int failed = 0;
+
+	// record
+	Tle5012Host sensor;
+	TimerHost timer(&sensor.sim);
+	SPICTrace trace(&sensor.bus, 0, memorySink, &recorded, &timer);
+	trace.writeHeader();
+	trace.init();
+	sensor.sBus = &trace;
+	sensor.sim.setTrajectory(0.0, 3000.0, 20000.0);
+	uint64_t start = benchNanos();
+	workload(sensor, live, &sensor.sim);
+	double liveNs = (double) (benchNanos() - start) / NUM_ROUNDS;
+	CHECK(recorded.length < TRACE_SIZE);
+
+	uint8_t crcErrors = 0;
+	for (uint16_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		crcErrors += (live[n].status != NO_ERROR) ? 1 : 0;
+	}
+	CHECK(crcErrors == 1);
+
+	// file round trip
+	FILE *file = fopen(TRACE_FILE, "wb");
+	CHECK(file != NULL);
+	if (file != NULL)
+	{
+		fwrite(recorded.data, 1, recorded.length, file);
+		fclose(file);
+	}
+	file = fopen(TRACE_FILE, "rb");
+	CHECK(file != NULL);
+	if (file != NULL)
+	{
+		loaded.length = (uint32_t) fread(loaded.data, 1, TRACE_SIZE, file);
+		fclose(file);
+	}
+	CHECK(loaded.length == recorded.length);
+
+	// replay gives the same results
+	SPICReplay replay(loaded.data, loaded.length, 0);
+	CHECK(replay.init() == SPIC::OK);
+	Tle5012b copy;
+	copy.sBus = &replay;
+	start = benchNanos();
+	workload(copy, replayed, NULL);
+	double replayNs = (double) (benchNanos() - start) / NUM_ROUNDS;
+	CHECK(replay.mismatches == 0);
+	CHECK(replay.overruns == 0);
+	CHECK(memcmp(live, replayed, sizeof(live)) == 0);
+	CHECK(replay.timestamp() > 0);
+	uint32_t transfers = replay.transfers;
+
+	// a driver which skips the prediction write is found
+	replay.rewind();
+	Tle5012b changed;
+	changed.sBus = &replay;
+	changed.writeSlaveNumber(changed.mSlave);
+	changed.readBlockCRC();
+	for (uint16_t n = 0; n < NUM_ROUNDS; n++)
+	{
+		int32_t value = 0;
+		changed.getAngleQ16(value);
+		changed.getAngleSpeedCdeg(value);
+		if ((n % 10) == 0)
+		{
+			int16_t revolutions = 0;
+			changed.getNumRevolutions(revolutions);
+			changed.getTemperatureQ8(value);
+			changed.readRegisters(Reg::MASK_AVAL | Reg::MASK_T25O);
+		}
+	}
+	CHECK(replay.mismatches > 0);
+
+	// two sensors recorded into one trace are replayed separately
+	static traceBuffer shared;
+	static roundResult first[NUM_ROUNDS];
+	static roundResult second[NUM_ROUNDS];
+	Tle5012Host sensor1;
+	Tle5012Host sensor2(Tle5012b::TLE5012B_S1);
+	SPICTrace trace1(&sensor1.bus, 1, memorySink, &shared);
+	SPICTrace trace2(&sensor2.bus, 2, memorySink, &shared);
+	trace1.writeHeader();
+	sensor1.sBus = &trace1;
+	sensor2.sBus = &trace2;
+	sensor2.sim.setTrajectory(90.0, -500.0);
+	workload(sensor1, first, &sensor1.sim);
+	workload(sensor2, second, &sensor2.sim);
+	SPICReplay replay1(shared.data, shared.length, 1);
+	SPICReplay replay2(shared.data, shared.length, 2);
+	Tle5012b copy1;
+	Tle5012b copy2;
+	copy1.sBus = &replay1;
+	copy2.sBus = &replay2;
+	copy2.mSlave = Tle5012b::TLE5012B_S1;
+	workload(copy1, replayed, NULL);
+	CHECK(memcmp(first, replayed, sizeof(first)) == 0);
+	workload(copy2, replayed, NULL);
+	CHECK(memcmp(second, replayed, sizeof(second)) == 0);
+	CHECK((replay1.mismatches == 0) && (replay2.mismatches == 0));
+
+	// a list through the recorder runs as one transaction of the host bus
+	sensor.bus.setupTime = 2000;
+	uint64_t listStart = sensor.sim.now();
+	CHECK(sensor.readRegisters(Reg::MASK_AVAL | Reg::MASK_T25O) == NO_ERROR);
+	uint64_t listNs = sensor.sim.now() - listStart;
+	sensor.sBus = &sensor.bus;
+	listStart = sensor.sim.now();
+	CHECK(sensor.readRegisters(Reg::MASK_AVAL | Reg::MASK_T25O) == NO_ERROR);
+	CHECK(sensor.sim.now() - listStart == listNs);
+
+	printf("trace              %u transfers, %u bytes, %.1f bytes per transfer\n",
+		transfers, recorded.length, (double) recorded.length / transfers);
+	printf("workload round     model %.1f ns, replay %.1f ns\n", liveNs, replayNs);
+
+	return (failed == 0 ? 0 : 1);
+}
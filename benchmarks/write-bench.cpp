@@ -0,0 +1,123 @@
+/**
+ * @file        write-bench.cpp
+ * @brief       Bus traffic of configuration writes with and without a write transaction
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * Changes five configuration bit fields once with single writes, each
+ * followed by a CRC_PAR update, and once inside a write transaction with
+ * one CRC_PAR update at commit. Prints the transfers and bus words of both
+ * and checks that the register files and the CRC_PAR end up identical, also
+ * when a write fails in the middle of a commit.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.hpp"
+#include "bench-spic.hpp"
+
+#define CHECK(cond)   do { if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); failed++; } } while (0)
+
+static void configure(Tle5012b &sensor)
+{
+	sensor.reg.setHysteresisMode(2);
+	sensor.reg.setAngleRange(Reg::factor4);
+	sensor.reg.enablePrediction();
+	sensor.reg.enableSpikeFilter();
+	sensor.reg.setIFABres(1);
+}
+
+static uint8_t crcPar(BenchSPIC &bus)
+{
+	uint8_t data[16];
+	for (uint8_t i = 0; i < CRC_NUM_REGISTERS; i++)
+	{
+		data[2 * i] = (uint8_t) (bus.regs[0x08 + i] >> 8);
+		data[2 * i + 1] = (uint8_t) bus.regs[0x08 + i];
+	}
+	return (crc8(data, 15));
+}
+
+int main()
+{
+	BenchSPIC single;
+	BenchSPIC batched;
+	BenchSPIC local;
+	BenchSPIC localBatched;
+	Tle5012b sensor;
+	Tle5012b localSensor;
+	int failed = 0;
+
+	sensor.sBus = &single;
+	configure(sensor);
+
+	sensor.sBus = &batched;
+	sensor.reg.invalidateCache();
+	sensor.reg.beginTransaction();
+	configure(sensor);
+	uint32_t staged = batched.transfers;
+	CHECK(sensor.reg.commit() == NO_ERROR);
+
+	// local CRC mode, the register block is read once at begin
+	localSensor.sBus = &local;
+	localSensor.enableLocalCrc();
+	CHECK(localSensor.readBlockCRC() == NO_ERROR);
+	local.transfers = 0;
+	local.words = 0;
+	configure(localSensor);
+
+	localSensor.sBus = &localBatched;
+	localSensor.reg.invalidateCache();
+	CHECK(localSensor.readBlockCRC() == NO_ERROR);
+	localBatched.transfers = 0;
+	localBatched.words = 0;
+	localSensor.reg.beginTransaction();
+	configure(localSensor);
+	CHECK(localSensor.reg.commit() == NO_ERROR);
+
+	printf("%-30s %10s %10s\n", "5 bit field changes", "transfers", "words");
+	printf("%-30s %10u %10u\n", "single writes", single.transfers, single.words);
+	printf("%-30s %10u %10u\n", "write transaction", batched.transfers, batched.words);
+	printf("%-30s %10u %10u\n", "single writes, local CRC", local.transfers, local.words);
+	printf("%-30s %10u %10u\n", "write transaction, local CRC", localBatched.transfers, localBatched.words);
+
+	CHECK(memcmp(single.regs, batched.regs, sizeof(single.regs)) == 0);
+	CHECK(memcmp(single.regs, local.regs, sizeof(single.regs)) == 0);
+	CHECK(memcmp(single.regs, localBatched.regs, sizeof(single.regs)) == 0);
+	CHECK(localSensor.checkCrcShadow() == NO_ERROR);
+
+	// the health check finds registers changed behind the driver
+	localBatched.regs[0x0B] ^= 0x0010;
+	CHECK(localSensor.checkCrcShadow() == CRC_ERROR);
+	CHECK(localSensor.checkCrcShadow() == CRC_ERROR);
+	localSensor.reg.setOffsetY(7);
+	CHECK(localSensor.checkCrcShadow() == NO_ERROR);
+	CHECK((uint8_t) localBatched.regs[0x0F] == crcPar(localBatched));
+	CHECK((uint8_t) batched.regs[0x0F] == crcPar(batched));
+	CHECK(staged == 4);
+
+	// an aborted transaction writes nothing and drops the changes
+	batched.transfers = 0;
+	sensor.reg.beginTransaction();
+	sensor.reg.setHysteresisMode(3);
+	sensor.reg.abortTransaction();
+	CHECK(sensor.reg.getHysteresisMode() == 2);
+	CHECK(batched.transfers == 2);
+
+	// a write failing in the middle of a commit still leaves a valid CRC_PAR
+	sensor.reg.beginTransaction();
+	sensor.reg.setOffsetX(-21);
+	sensor.reg.setOffsetY(37);
+	sensor.reg.setAmplitudeSynch(-5);
+	batched.failWrite = 2;
+	CHECK(sensor.reg.commit() == CRC_ERROR);
+	CHECK(batched.failWrite == 0);
+	CHECK((uint8_t) batched.regs[0x0F] == crcPar(batched));
+	CHECK(sensor.reg.getOffsetY() == 37);
+
+	if (failed != 0)
+	{
+		return (1);
+	}
+	return (0);
+}
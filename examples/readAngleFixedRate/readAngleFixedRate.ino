@@ -0,0 +1,72 @@
+/*!
+ * \name        readAngleFixedRate
+ * \author      Infineon Technologies AG
+ * \copyright   2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       reads the angle value at a fixed sample rate
+ * \details
+ * Instead of a delay in the loop, which lets the sample rate drift with
+ * the SPI and serial time, the Tle5012Sampler reads the angle every 10 ms
+ * on a fixed time grid. Each sample has its timestamp and read latency.
+ * Every second the period jitter and read latency statistics are printed.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <TLE5012-ino.hpp>
+
+#define SAMPLE_PERIOD_US   10000
+#define SAMPLES_PER_PRINT  100
+
+// Tle5012b Object
+Tle5012Ino Tle5012MagneticAngleSensor = Tle5012Ino();
+TimerIno timer = TimerIno();
+Tle5012Sampler sampler = Tle5012Sampler(Tle5012MagneticAngleSensor, timer);
+errorTypes checkError = NO_ERROR;
+
+void setup() {
+  delay(2000);
+  Serial.begin(115200);
+  while (!Serial) {};
+  checkError = Tle5012MagneticAngleSensor.begin();
+  Serial.print("checkError: ");
+  Serial.println(checkError,HEX);
+  timer.init();
+  // AVR micros() counts in 4 us steps
+  sampler.begin(SAMPLE_PERIOD_US, 4);
+  Serial.println("init done");
+}
+
+void loop() {
+  Tle5012Sampler::sample s;
+  checkError = sampler.next(s);
+  Serial.print(s.time);
+  Serial.print("\t");
+  Serial.print(s.value * (360.0 / 65536.0));
+  Serial.print("\t");
+  Serial.println(s.latency);
+
+  if ((s.index % SAMPLES_PER_PRINT) == (SAMPLES_PER_PRINT - 1))
+  {
+    Serial.print("jitter us min/max/mean/p99: ");
+    Serial.print(sampler.jitter.min);
+    Serial.print("/");
+    Serial.print(sampler.jitter.max);
+    Serial.print("/");
+    Serial.print(sampler.jitter.mean());
+    Serial.print("/");
+    Serial.println(sampler.jitter.percentile(99));
+    Serial.print("latency us min/max/mean/p99: ");
+    Serial.print(sampler.latency.min);
+    Serial.print("/");
+    Serial.print(sampler.latency.max);
+    Serial.print("/");
+    Serial.print(sampler.latency.mean());
+    Serial.print("/");
+    Serial.println(sampler.latency.percentile(99));
+    Serial.print("missed periods: ");
+    Serial.println(sampler.missed);
+    sampler.resetStats();
+  }
+}
@@ -13,6 +13,9 @@
  * ask for. The loop function will than print out the individual sensor(s) angle values.
  *  
  * This example also demonstrates how to handle more than on sensor in an array setup.
+ * The Tle5012bBus scheduler reads all sensors every 100 ms on a fixed time grid, each
+ * with one burst for the angle and the revolutions, and hands every sample with its
+ * timestamp to the printSample callback.
  * 
  * \attention Needs much memory which can be too much for the original Arduino/Genuino Uno
  * 
@@ -39,12 +42,27 @@ Tle5012Ino sensor[SENSOR_NUM] = {
 //  (Tle5012Ino(CS_PIN_SENSOR_4,sensor[1].TLE5012B_S3)),
 };
 
+//! read period of each sensor in us
+#define SAMPLE_PERIOD_US  100000
+
+//! Timer and scheduler of the sensors on the SPI line
+TimerIno timer = TimerIno();
+Tle5012bBus bus = Tle5012bBus(timer);
+
 //! Sensor IFX SIL(TM) errorCheck
 errorTypes checkError = NO_ERROR;
 
-//! array if the read angle values and revolutions
-double d[4] = {0.0, 0.0, 0.0, 0.0};
-int16_t r[4] = {0, 0, 0, 0};
+//! prints the timestamp, angle and revolutions of one sensor
+void printSample(const Tle5012bBus::sample &s, void *context) {
+  Tle5012b::motionSnapshot motion = s.motion;
+  Serial.print(s.sensor);
+  Serial.print("\t");
+  Serial.print(s.time);
+  Serial.print("\t");
+  Serial.print(motion.angle());
+  Serial.print(",");
+  Serial.println(motion.revolutions);
+}
 
 void setup() {
   delay(2000);
@@ -96,19 +114,16 @@ void setup() {
   }
   delay(1000);
   Serial.println();
+
+  timer.init();
+  for (int8_t i=0;i<SENSOR_NUM;i++)
+  {
+    bus.addSensor(sensor[i], SAMPLE_PERIOD_US);
+  }
+  bus.setCallback(printSample, NULL);
+  bus.begin();
 }
 
 void loop() {
-  for (int8_t i=0;i<SENSOR_NUM;i++){
-    d[i] = 0.0;
-    r[i] = 0;
-    sensor[i].getAngleValue(d[i]);
-    sensor[i].getNumRevolutions(r[i]);
-    Serial.print("\t");
-    Serial.print(d[i]);
-    Serial.print(",");
-    Serial.print(r[i]);
-  }
-  Serial.println("");
-  delay(100);
+  bus.next();
 }
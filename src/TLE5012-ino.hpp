@@ -24,7 +24,16 @@
  */
 
 #include "corelib/TLE5012b.hpp"
+#include "corelib/tle5012b_sampler.hpp"
+#include "corelib/tle5012b_position.hpp"
+#include "corelib/tle5012b_estimator.hpp"
+#include "corelib/tle5012b_predictor.hpp"
+#include "corelib/tle5012b_foc.hpp"
+#include "corelib/tle5012b_async.hpp"
+#include "corelib/tle5012b_bus.hpp"
+#include "corelib/tle5012b_ring.hpp"
 #include "framework/arduino/wrapper/TLE5012-platf-ino.hpp"
+#include "framework/arduino/pal/timer-arduino.hpp"
 
 /**
  * @class Tle5012Ino
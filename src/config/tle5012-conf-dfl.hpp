@@ -19,6 +19,63 @@
 #error  'TLE5012 error framework undefined'    /**< TLE5012 framework must be defined in conf. or at compilation */
 #endif
 
+#ifndef TLE5012_CRC_IMPL
+#if defined(__AVR__)
+#define TLE5012_CRC_IMPL    TLE5012_CRC_NIBBLE    /**< AVR keeps const tables in RAM, so use the 16 byte nibble table */
+#else
+#define TLE5012_CRC_IMPL    TLE5012_CRC_TABLE     /**< all other platforms use the full table driven CRC */
+#endif
+#endif
+
+#ifndef TLE5012_DOUBLE_API
+#define TLE5012_DOUBLE_API  1    /**< 1 builds the double get functions, 0 drops them and leaves the integer ones for FPU-less targets */
+#endif
+
+#ifndef TLE5012_SPIC_STATS
+#define TLE5012_SPIC_STATS  0    /**< 1 builds the SPICStats bus instrumentation, 0 leaves it out completely */
+#endif
+
+#ifndef TLE5012_SPIC_STATS_BUCKETS
+#define TLE5012_SPIC_STATS_BUCKETS  12    /**< latency histogram buckets per register, bucket n counts transfers below 2^n us */
+#endif
+
+#ifndef TLE5012_SPIC_TRACE
+#define TLE5012_SPIC_TRACE  0    /**< 1 builds the SPICTrace recorder and the SPICReplay bus, 0 leaves them out completely */
+#endif
+
+#ifndef TLE5012_SPIC_ASYNC
+#define TLE5012_SPIC_ASYNC  0    /**< 1 builds the SPICQueue request queue and the Tle5012Async front-end, 0 leaves them out completely */
+#endif
+
+#ifndef TLE5012_SPIC_QUEUE_DEPTH
+#define TLE5012_SPIC_QUEUE_DEPTH  4    /**< requests of the SPICQueue ring and tokens of Tle5012Async, a power of two */
+#endif
+
+#ifndef TLE5012_XMC_ASYNC
+#define TLE5012_XMC_ASYNC  0    /**< 1 builds the USIC FIFO and interrupt transfers of SPIC::sendReceiveAsync on XMC, they take the USICx_5 interrupt handlers
+                                     and busy wait in the interrupt for about 5 us per command and 1 us between two commands, the turnaround and chip select pause */
+#endif
+
+#ifndef TLE5012_SAMPLER_BUCKETS
+#define TLE5012_SAMPLER_BUCKETS  32    /**< histogram buckets of the Tle5012Sampler jitter and latency statistics */
+#endif
+
+#ifndef TLE5012_ESTIMATOR_BANDWIDTH
+#define TLE5012_ESTIMATOR_BANDWIDTH  4    /**< Tle5012Estimator tracking loop bandwidth of 2^-n per update period, 4 is about 230 Hz at FIR_MD 1 */
+#endif
+
+#ifndef TLE5012_SINCOS_BITS
+#if defined(__AVR__)
+#define TLE5012_SINCOS_BITS  6    /**< AVR keeps const tables in RAM, so use 64 segments per quarter wave, 130 bytes, 3.5 LSB Q15 sin/cos error, 1 to 13 bits */
+#else
+#define TLE5012_SINCOS_BITS  8    /**< 256 segments per quarter wave, 514 bytes, 1.2 LSB Q15 sin/cos error, 1 to 13 bits */
+#endif
+#endif
+
+#ifndef TLE5012_PREDICTOR_FRAMES
+#define TLE5012_PREDICTOR_FRAMES  256    /**< update periods timed by Tle5012Predictor::calibrate, 256 take about 11 ms at FIR_MD 1 */
+#endif
+
 /** @} */
 
 #endif /** TLE5012_CONF_DFL_HPP_ **/
@@ -20,6 +20,12 @@
 #define TLE5012_FRMWK_WICED     0x02U
 #define TLE5012_FRMWK_MTB       0x03U
 #define TLE5012_FRMWK_PSOC      0x04U
+#define TLE5012_FRMWK_HOST      0x05U    /**< Linux/macOS host with the simulated sensor, see framework/host */
+
+//!< \brief List of available CRC8 implementations
+#define TLE5012_CRC_BITWISE     0x01U    /**< bit by bit, no table, smallest code */
+#define TLE5012_CRC_NIBBLE      0x02U    /**< 16 byte nibble table, for small flash/RAM targets */
+#define TLE5012_CRC_TABLE       0x03U    /**< 256 byte table plus 256 byte word table, fastest */
 
 /** @} */
 
@@ -36,47 +36,7 @@ uint8_t getSecondByte(uint16_t twoByteWord)
 	return ((uint8_t) twoByteWord);
 }
 
-/*!
- * Function for calculation the CRC.
- * @param data byte long data for CRC check
- * @param length length of data
- * @return returns 8bit CRC
- */
-uint8_t crc8(uint8_t *data, uint8_t length)
-{
-	uint32_t crc;
-	int16_t i, bit;
-
-	crc = CRC_SEED;
-	for (i = 0; i < length; i++)
-	{
-		crc ^= data[i];
-		for (bit = 0; bit < 8; bit++)
-		{
-			if ((crc & 0x80) != 0)
-			{
-				crc <<= 1;
-				crc ^= CRC_POLYNOMIAL;
-			}else{
-				crc <<= 1;
-			}
-		}
-	}
-
-	return ((~crc) & CRC_SEED);
-}
-
-/*!
- * Function for calculation of the CRC
- * @param crcData byte long data for CRC check
- * @param length length of data
- * @return runs crc8 calculation and returns CRC
- */
-uint8_t crcCalc(uint8_t* crcData, uint8_t length)
-{
-	return (crc8(crcData, length));
-}
-
+#if (TLE5012_DOUBLE_API == 1)
 /*!
  * Calculate the angle speed
  * @param angRange set angular range value
@@ -108,6 +68,49 @@ double calculateAngleSpeed(double angRange, int16_t rawAngleSpeed, uint16_t firM
 	finalAngleSpeed = ((angRange / POW_2_15) * ((double) rawAngleSpeed)) / (((double) predictionVal) * firMDVal * microsecToSec);
 	return (finalAngleSpeed);
 }
+#endif
+
+/*!
+ * Divides and rounds half away from zero
+ * @param numerator signed dividend
+ * @param denominator positive divisor
+ * @return rounded quotient
+ */
+int64_t divideRounded(int64_t numerator, int64_t denominator)
+{
+	if (numerator < 0)
+	{
+		return (-((-numerator + (denominator / 2)) / denominator));
+	}
+	return ((numerator + (denominator / 2)) / denominator);
+}
+
+/*!
+ * Calculate the fixed-point angle speed scale, so that the speed in cdeg/s
+ * is (rawAngleSpeed * scale) >> shift. The scale is normalized to 31 bits.
+ * @param rawAngleRange ANG_RANGE bits 14:4 of MOD_2
+ * @param firMD FIR_MD bits 15:14 of MOD_1
+ * @param predictionVal 3 with prediction, 2 without
+ * @param shift number of fractional bits of the scale
+ * @return scale in cdeg/s per raw speed step
+ */
+uint32_t calculateSpeedScaleQ(uint16_t rawAngleRange, uint16_t firMD, uint16_t predictionVal, uint8_t &shift)
+{
+	// FIR_MD update times in 0.1 µs, so all factors of the double formula are integers
+	static const int16_t firMDVal[4] = { 213, 427, 853, 1706 };
+	const int64_t scaleMax = 0x7FFFFFFFL;
+	int64_t divisor = (int64_t) rawAngleRange * predictionVal * firMDVal[firMD & 0x3];
+	shift = 0;
+	if (divisor == 0)
+	{
+		return ((uint32_t) scaleMax);
+	}
+	while (((SPEED_CDEG_FACTOR << (shift + 1)) / divisor) <= scaleMax)
+	{
+		shift++;
+	}
+	return ((uint32_t) divideRounded(SPEED_CDEG_FACTOR << shift, divisor));
+}
 // end none class functions
 
 //-----------------------------------------------------------------------------
@@ -118,6 +121,9 @@ Tle5012b::Tle5012b():reg(this)
 	en = NULL;
 	safetyWord = 0;
 	mSlave = TLE5012B_S0;
+	_localCrc = false;
+	_crcShadowValid = false;
+	_speedScaleValid = false;
 }
 
 Tle5012b::~Tle5012b()
@@ -154,12 +160,18 @@ errorTypes Tle5012b::readFromSensor(uint16_t command, uint16_t &data, updTypes u
 	errorTypes checkError = NO_ERROR;
 
 	_command[0] = READ_SENSOR | command | upd | safe;
-	uint16_t _received[MAX_REGISTER_MEM] = {0};
-	sBus->sendReceive(_command, 1, _received, 2);
-	data = _received[0];
+	uint16_t received[2];
+	crc8Ctx_t crc;
+	if (safe == SAFE_high)
+	{
+		sBus->sendReceiveCrc(_command, 1, received, 2, crc);
+	}else{
+		sBus->sendReceive(_command, 1, received, 1);
+	}
+	data = received[0];
 	if (safe == SAFE_high)
 	{
-		checkError = checkSafety(_received[1], _command[0], &_received[0], 1);
+		checkError = checkSafetyCrc(received[1], crcFinal(crc));
 		if (checkError != NO_ERROR)
 		{
 			data = 0;
@@ -172,14 +184,25 @@ errorTypes Tle5012b::readMoreRegisters(uint16_t command, uint16_t data[], updTyp
 {
 	errorTypes checkError = NO_ERROR;
 
-	_command[0] = READ_SENSOR | command | upd | safe;
-	uint16_t _received[MAX_REGISTER_MEM] = {0};
+	_command[0] = READ_SENSOR | command | upd;
+	// the safety word is appended by the sensor, so the safe bit
+	// must not change a given number of registers to read
+	if ((command & 0x000F) == 0)
+	{
+		_command[0] |= safe;
+	}
 	uint16_t _recDataLength = (_command[0] & (0x000F)); // Number of registers to read
-	sBus->sendReceive(_command, 1, _received, _recDataLength + safe);
+	crc8Ctx_t crc;
+	if (safe == SAFE_high)
+	{
+		sBus->sendReceiveCrc(_command, 1, _received, _recDataLength + 1, crc);
+	}else{
+		sBus->sendReceive(_command, 1, _received, _recDataLength);
+	}
 	memcpy(data, _received, (_recDataLength)* sizeof(uint16_t));
 	if (safe == SAFE_high)
 	{
-		checkError = checkSafety(_received[_recDataLength], _command[0], _received, _recDataLength);
+		checkError = checkSafetyCrc(_received[_recDataLength], crcFinal(crc));
 		if (checkError != NO_ERROR)
 		{
 			data = 0;
@@ -188,6 +211,37 @@ errorTypes Tle5012b::readMoreRegisters(uint16_t command, uint16_t data[], updTyp
 	return (checkError);
 }
 
+errorTypes Tle5012b::readBurst(uint16_t command, uint16_t buffer[], uint16_t bufferLength, updTypes upd, safetyTypes safe)
+{
+	errorTypes checkError = NO_ERROR;
+	uint16_t length = command & 0x000F;
+
+	_command[0] = READ_SENSOR | command | upd;
+	if (length == 0)
+	{
+		_command[0] |= safe;
+		length = safe;
+	}
+	if (bufferLength < length + safe)
+	{
+		return (BUFFER_SIZE_ERROR);
+	}
+	if (safe == SAFE_high)
+	{
+		crc8Ctx_t crc;
+		sBus->sendReceiveCrc(_command, 1, buffer, length + 1, crc);
+		checkError = checkSafetyCrc(buffer[length], crcFinal(crc));
+	}else{
+		sBus->sendReceive(_command, 1, buffer, length);
+	}
+	return (checkError);
+}
+
+errorTypes Tle5012b::checkTransfer(uint16_t safety, crc8Ctx_t crc)
+{
+	return (checkSafetyCrc(safety, crcFinal(crc)));
+}
+
 errorTypes Tle5012b::writeToSensor(uint16_t command, uint16_t dataToWrite, bool changeCRC)
 {
 	uint16_t safety = 0;
@@ -196,6 +250,8 @@ errorTypes Tle5012b::writeToSensor(uint16_t command, uint16_t dataToWrite, bool
 	sBus->sendReceive(_command, 2, &safety, 1);
 
 	errorTypes checkError = checkSafety(safety, _command[0], &_command[1], 1);
+	invalidateWritten(command, dataToWrite);
+	updateCrcShadow(command, dataToWrite, checkError);
 	//if we write to a register, which changes the CRC.
 	if (changeCRC)
 	{
@@ -204,6 +260,38 @@ errorTypes Tle5012b::writeToSensor(uint16_t command, uint16_t dataToWrite, bool
 	return (checkError);
 }
 
+void Tle5012b::invalidateWritten(uint16_t command, uint16_t dataToWrite)
+{
+	uint16_t address = command & REG_ADDRESS_MASK;
+	uint8_t pos = Reg::posFromAddress(address);
+
+	// resets and the fuse reload change all registers
+	if (((address == reg.REG_ACSTAT) && (dataToWrite & ACSTAT_RESET_MASK))
+		|| ((address == reg.REG_SIL) && (dataToWrite & SIL_FUSEREL_MASK)))
+	{
+		reg.invalidateCache();
+		_crcShadowValid = false;
+	}else if (pos < MAX_NUM_REG)
+	{
+		reg.invalidateCache(1UL << pos);
+	}
+}
+
+void Tle5012b::updateCrcShadow(uint16_t command, uint16_t dataToWrite, errorTypes status)
+{
+	uint16_t address = command & REG_ADDRESS_MASK;
+
+	if ((address >= reg.REG_MOD_2) && (address <= reg.REG_TCO_Y))
+	{
+		_registers[(address - reg.REG_MOD_2) >> 4] = dataToWrite;
+		// the write may or may not have reached the sensor
+		if (status != NO_ERROR)
+		{
+			_crcShadowValid = false;
+		}
+	}
+}
+
 errorTypes Tle5012b::writeTempCoeffUpdate(uint16_t dataToWrite)
 {
 	uint16_t safety = 0;
@@ -213,10 +301,14 @@ errorTypes Tle5012b::writeTempCoeffUpdate(uint16_t dataToWrite)
 	_command[1] = dataToWrite;
 	sBus->sendReceive(_command, 2, &safety, 1);
 	errorTypes checkError = checkSafety(safety, _command[0], &_command[1], 1);
+	reg.invalidateCache(Reg::MASK_TCO_Y);
+	updateCrcShadow(reg.REG_TCO_Y, dataToWrite, checkError);
 	//
 	checkError = readStatus(readreg);
 	if (readreg & 0x0008)
 	{
+		// fuse CRC still wrong, so take the register values from the sensor
+		_crcShadowValid = false;
 		checkError = regularCrcUpdate();
 	}
 	return (checkError);
@@ -227,10 +319,22 @@ errorTypes Tle5012b::writeTempCoeffUpdate(uint16_t dataToWrite)
 //-----------------------------------------------------------------------------
 // begin CRC functions
 errorTypes Tle5012b::checkSafety(uint16_t safety, uint16_t command, uint16_t* readreg, uint16_t length)
+{
+	return (checkSafetyCrc(safety, crc8Words(command, readreg, length)));
+}
+
+errorTypes Tle5012b::checkSafetyCrc(uint16_t safety, uint8_t crc)
 {
 	errorTypes errorCheck;
 	safetyWord = safety;
 
+	// after a chip reset all registers may have changed
+	if (safety & CHIP_RESET_MASK)
+	{
+		reg.invalidateCache();
+		_crcShadowValid = false;
+	}
+
 
 	if (!((safety) & SYSTEM_ERROR_MASK))
 	{
@@ -246,20 +350,7 @@ errorTypes Tle5012b::checkSafety(uint16_t safety, uint16_t command, uint16_t* re
 		//resetSafety();
 	}else{
 		//resetSafety();
-		uint16_t lengthOfTemp = length * 2 + 2;
-		uint8_t temp[lengthOfTemp];
-
-		temp[0] = getFirstByte(command);
-		temp[1] = getSecondByte(command);
-
-		for (uint16_t i = 0; i < length; i++)
-		{
-			temp[2 + 2 * i] = getFirstByte(readreg[i]);
-			temp[2 + 2 * i + 1] = getSecondByte(readreg[i]);
-		}
-
 		uint8_t crcReceivedFinal = getSecondByte(safety);
-		uint8_t crc = crcCalc(temp, lengthOfTemp);
 
 		if (crc == crcReceivedFinal)
 		{
@@ -289,7 +380,11 @@ errorTypes Tle5012b::resetFirmware()
 
 errorTypes Tle5012b::regularCrcUpdate()
 {
-	readBlockCRC();
+	// in local CRC mode _registers follows all writes and is only read after resets
+	if (!(_localCrc && _crcShadowValid))
+	{
+		readBlockCRC();
+	}
 	uint8_t temp[16];
 	for (uint8_t i = 0; i < CRC_NUM_REGISTERS; i++)
 	{
@@ -304,6 +399,42 @@ errorTypes Tle5012b::regularCrcUpdate()
 
 	return (writeTempCoeffUpdate(valToSend));
 }
+
+void Tle5012b::enableLocalCrc()
+{
+	_localCrc = true;
+}
+
+void Tle5012b::disableLocalCrc()
+{
+	_localCrc = false;
+}
+
+errorTypes Tle5012b::checkCrcShadow()
+{
+	uint16_t chipRegisters[CRC_NUM_REGISTERS] = {};
+	uint8_t temp[16];
+
+	errorTypes checkError = readMoreRegisters(reg.REG_MOD_2 + CRC_NUM_REGISTERS, chipRegisters, UPD_low, SAFE_high);
+	if (checkError != NO_ERROR)
+	{
+		return (checkError);
+	}
+	for (uint8_t i = 0; i < CRC_NUM_REGISTERS; i++)
+	{
+		temp[2 * i] = getFirstByte(chipRegisters[i]);
+		temp[(2 * i) + 1] = getSecondByte(chipRegisters[i]);
+	}
+	// the sensor must hold the CRC_PAR of its own registers and the shadow its values
+	if ((crcCalc(temp, 15) != temp[15])
+		|| (_crcShadowValid && (memcmp(chipRegisters, _registers, sizeof(chipRegisters)) != 0)))
+	{
+		checkError = CRC_ERROR;
+	}
+	memcpy(_registers, chipRegisters, sizeof(chipRegisters));
+	_crcShadowValid = true;
+	return (checkError);
+}
 // end CRC functions
 
 
@@ -312,9 +443,10 @@ errorTypes Tle5012b::regularCrcUpdate()
 errorTypes Tle5012b::readBlockCRC()
 {
 	_command[0] = READ_BLOCK_CRC;
-	_registers[CRC_NUM_REGISTERS + 1] = {0};  // Number of CRC Registers + 1 Register for Safety word
+	// Number of CRC Registers + 1 Register for Safety word
 	sBus->sendReceive(_command, 1, _registers, CRC_NUM_REGISTERS+1);
 	errorTypes checkError = checkSafety(_registers[8], READ_BLOCK_CRC, _registers, CRC_NUM_REGISTERS);
+	_crcShadowValid = (checkError == NO_ERROR);
 	resetSafety();
 	return (checkError);
 }
@@ -410,6 +542,7 @@ errorTypes Tle5012b::readRawY(int16_t &data)
 
 //-----------------------------------------------------------------------------
 // begin get functions
+#if (TLE5012_DOUBLE_API == 1)
 errorTypes Tle5012b::getAngleValue(double &angleValue)
 {
 	int16_t rawAnglevalue = 0;
@@ -458,6 +591,46 @@ errorTypes Tle5012b::getTemperature(double &temperature, int16_t &rawTemp, updTy
 	return (status);
 }
 
+#endif
+
+errorTypes Tle5012b::getAngleQ16(int32_t &angleQ16, updTypes upd, safetyTypes safe)
+{
+	uint16_t rawData = 0;
+	errorTypes status = readFromSensor(reg.REG_AVAL, rawData, upd, safe);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	rawData = (rawData & (DELETE_BIT_15));
+	//check if the value received is positive or negative
+	if (rawData & CHECK_BIT_14)
+	{
+		rawData = rawData - CHANGE_UINT_TO_INT_15;
+	}
+	angleQ16 = (int32_t) ((int16_t) rawData) * ANGLE_Q16_FACTOR;
+	return (status);
+}
+
+errorTypes Tle5012b::getTemperatureQ8(int32_t &temperatureQ8, updTypes upd, safetyTypes safe)
+{
+	uint16_t rawData = 0;
+	errorTypes status = readFromSensor(reg.REG_FSYNC, rawData, upd, safe);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	rawData = (rawData & (DELETE_7BITS));
+	//check if the value received is positive or negative
+	if (rawData & CHECK_BIT_9)
+	{
+		rawData = rawData - CHANGE_UNIT_TO_INT_9;
+	}
+	// stays in 32 bit, no 64 bit division needed for the temperature
+	int32_t scaled = ((int32_t) ((int16_t) rawData) + TEMP_OFFSET_INT) * (int32_t) TEMP_FACTOR_Q16;
+	temperatureQ8 = (scaled < 0 ? -((-scaled + 128) >> 8) : ((scaled + 128) >> 8));
+	return (status);
+}
+
 errorTypes Tle5012b::getNumRevolutions(int16_t &numRev, updTypes upd, safetyTypes safe)
 {
 	uint16_t rawData = 0;
@@ -476,6 +649,68 @@ errorTypes Tle5012b::getNumRevolutions(int16_t &numRev, updTypes upd, safetyType
 	return (status);
 }
 
+void Tle5012b::invalidateSpeedScale()
+{
+	_speedScaleValid = false;
+}
+
+errorTypes Tle5012b::updateSpeedScale()
+{
+	uint16_t mod1 = 0;
+	uint16_t mod2 = 0;
+	errorTypes status = reg.getRegister(Reg::posFromAddress(reg.REG_MOD_1), mod1);
+	if (status == NO_ERROR)
+	{
+		status = reg.getRegister(Reg::posFromAddress(reg.REG_MOD_2), mod2);
+	}
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+
+	// FIR_MD, prediction and angle range as in the former six register burst
+	uint16_t firMDVal = mod1 >> 14;
+	uint16_t intMode2Prediction = (mod2 & 0x0004) ? 3 : 2;
+	uint16_t rawAngleRange = (mod2 & GET_BIT_14_4) >> 4;
+#if (TLE5012_DOUBLE_API == 1)
+	double angleRange = ANGLE_360_VAL * (POW_2_7 / (double) (rawAngleRange));
+	_speedScale = calculateAngleSpeed(angleRange, 1, firMDVal, intMode2Prediction);
+#endif
+	_speedScaleQ = calculateSpeedScaleQ(rawAngleRange, firMDVal, intMode2Prediction, _speedScaleShift);
+	// getRegister may have refreshed MOD_1 or MOD_2 which invalidates, so set valid last
+	_speedScaleValid = true;
+	return (status);
+}
+
+errorTypes Tle5012b::readRawSpeed(int16_t &rawSpeed, updTypes upd, safetyTypes safe)
+{
+	errorTypes status = NO_ERROR;
+	if (!_speedScaleValid)
+	{
+		status = updateSpeedScale();
+		if (status != NO_ERROR)
+		{
+			return (status);
+		}
+	}
+
+	uint16_t rawData = 0;
+	status = readFromSensor(reg.REG_ASPD, rawData, upd, safe);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	rawData = (rawData & (DELETE_BIT_15));
+	// check if the value received is positive or negative
+	if (rawData & CHECK_BIT_14)
+	{
+		rawData = rawData - CHANGE_UINT_TO_INT_15;
+	}
+	rawSpeed = rawData;
+	return (status);
+}
+
+#if (TLE5012_DOUBLE_API == 1)
 errorTypes Tle5012b::getAngleSpeed(double &finalAngleSpeed)
 {
 	int16_t rawSpeed = 0;
@@ -483,49 +718,85 @@ errorTypes Tle5012b::getAngleSpeed(double &finalAngleSpeed)
 }
 errorTypes Tle5012b::getAngleSpeed(double &finalAngleSpeed, int16_t &rawSpeed, updTypes upd, safetyTypes safe)
 {
-	int8_t numOfData = 0x6;
-	uint16_t rawData[numOfData] = {};
-
-	errorTypes status = readMoreRegisters(reg.REG_ASPD + numOfData, rawData, upd, safe);
+	errorTypes status = readRawSpeed(rawSpeed, upd, safe);
 	if (status != NO_ERROR)
 	{
 		return (status);
 	}
+	finalAngleSpeed = _speedScale * rawSpeed;
+	return (status);
+}
+#endif
 
-	// Prepare raw speed
-	rawSpeed = rawData[0];
-	rawSpeed = (rawSpeed & (DELETE_BIT_15));
-	// check if the value received is positive or negative
-	if (rawSpeed & CHECK_BIT_14)
+errorTypes Tle5012b::getAngleSpeedCdeg(int32_t &speedCdeg, updTypes upd, safetyTypes safe)
+{
+	int16_t rawSpeed = 0;
+	errorTypes status = readRawSpeed(rawSpeed, upd, safe);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	const int64_t speedMax = 0x7FFFFFFFL;
+	int64_t speed = (int64_t) rawSpeed * _speedScaleQ;
+	if (_speedScaleShift > 0)
+	{
+		int64_t half = (int64_t) 1 << (_speedScaleShift - 1);
+		speed = (speed < 0 ? -((-speed + half) >> _speedScaleShift) : ((speed + half) >> _speedScaleShift));
+	}
+	if (speed > speedMax)
 	{
-		rawSpeed = rawSpeed - CHANGE_UINT_TO_INT_15;
+		speed = speedMax;
+	}else if (speed < -speedMax){
+		speed = -speedMax;
 	}
+	speedCdeg = (int32_t) speed;
+	return (status);
+}
 
-	// Prepare firMDVal
-	uint16_t firMDVal = rawData[3];
-	firMDVal >>= 14;
+errorTypes Tle5012b::readMotionSnapshot(motionSnapshot &snapshot, updTypes upd, safetyTypes safe)
+{
+	uint16_t rawData[MOTION_NUM_REGISTERS + 1];
 
-	// Prepare intMode2Prediction
-	uint16_t intMode2Prediction = rawData[5];
-	if (intMode2Prediction & 0x0004)
+	errorTypes status = readBurst(reg.REG_AVAL + MOTION_NUM_REGISTERS, rawData, MOTION_NUM_REGISTERS + 1, upd, safe);
+	if (status != NO_ERROR)
 	{
-		intMode2Prediction = 3;
-	}else{
-		intMode2Prediction = 2;
+		return (status);
 	}
 
-	// Prepare angle range
-	uint16_t rawAngleRange = rawData[5];
-	rawAngleRange &= GET_BIT_14_4;
-	rawAngleRange >>= 4;
-	double angleRange = ANGLE_360_VAL * (POW_2_7 / (double) (rawAngleRange));
-
-	//checks the value of fir_MD according to which the value in the calculation of the speed will be determined
-	//according to if prediction is enabled then, the formula for speed changes
-	finalAngleSpeed = calculateAngleSpeed(angleRange, rawSpeed, firMDVal, intMode2Prediction);
+	snapshot.decode(rawData);
 	return (status);
 }
 
+void Tle5012b::motionSnapshot::decode(uint16_t rawData[])
+{
+	// AVAL and ASPD are 15 bit signed values
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		rawData[i] &= DELETE_BIT_15;
+		if (rawData[i] & CHECK_BIT_14)
+		{
+			rawData[i] -= CHANGE_UINT_TO_INT_15;
+		}
+	}
+	rawAngle = rawData[0];
+	rawSpeed = rawData[1];
+
+	// AREV and FSYNC carry 9 bit signed values and the counters
+	frameCounter = (rawData[2] & GET_BIT_14_9) >> 9;
+	frameSync = (rawData[3] & GET_BIT_15_9) >> 9;
+	for (uint8_t i = 2; i < MOTION_NUM_REGISTERS; i++)
+	{
+		rawData[i] &= DELETE_7BITS;
+		if (rawData[i] & CHECK_BIT_9)
+		{
+			rawData[i] -= CHANGE_UNIT_TO_INT_9;
+		}
+	}
+	revolutions = rawData[2];
+	rawTemp = rawData[3];
+}
+
+#if (TLE5012_DOUBLE_API == 1)
 errorTypes Tle5012b::getAngleRange(double &angleRange)
 {
 	uint16_t rawData = 0;
@@ -540,9 +811,105 @@ errorTypes Tle5012b::getAngleRange(double &angleRange)
 	angleRange = ANGLE_360_VAL * (POW_2_7 / (double) (rawData));
 	return (status);
 }
+#endif
 // end get functions
 
 
+//-----------------------------------------------------------------------------
+// begin burst planner functions
+void Tle5012b::planRead(uint32_t regMask, readPlan &plan, updTypes upd, safetyTypes safe)
+{
+	uint8_t first = 0;
+	uint8_t last = 0;
+
+	plan.numBursts = 0;
+	plan.words = 0;
+	plan.singleWords = 0;
+	plan.upd = upd;
+	plan.safe = safe;
+	for (uint8_t i = 0; i < MAX_NUM_REG; i++)
+	{
+		if ((regMask & (1UL << i)) == 0)
+		{
+			continue;
+		}
+		plan.singleWords += 2 + safe;
+		uint8_t addr = reg.addrFields[i].regAddress >> 4;
+		uint8_t lastAddr = reg.addrFields[last].regAddress >> 4;
+		uint8_t firstAddr = reg.addrFields[first].regAddress >> 4;
+		// extend the open burst if the addresses in between exist, the gap
+		// costs not more than a new burst and the length field is not exceeded
+		if ((plan.numBursts > 0)
+			&& ((addr - lastAddr) == (i - last))
+			&& ((i - last - 1) <= MAX_PLAN_GAP)
+			&& ((addr - firstAddr + 1) <= MAX_BURST_LENGTH))
+		{
+			plan.bursts[plan.numBursts - 1].command += addr - lastAddr;
+			plan.words += addr - lastAddr;
+		}else{
+			plan.bursts[plan.numBursts].command = reg.addrFields[i].regAddress | 0x0001;
+			plan.bursts[plan.numBursts].pos = i;
+			plan.numBursts++;
+			plan.words += 2 + safe;
+			first = i;
+		}
+		last = i;
+	}
+}
+
+errorTypes Tle5012b::readPlanned(const readPlan &plan)
+{
+	errorTypes status = NO_ERROR;
+	uint16_t commands[MAX_PLAN_BURSTS];
+	crc8Ctx_t crc[MAX_PLAN_BURSTS];
+	SPIC::Command_t list[MAX_PLAN_BURSTS];
+	uint16_t offset = 0;
+
+	// all bursts in one command list, the responses one after the other in _received
+	for (uint8_t i = 0; i < plan.numBursts; i++)
+	{
+		uint16_t length = plan.bursts[i].command & 0x000F;
+		commands[i] = READ_SENSOR | plan.bursts[i].command | plan.upd;
+		list[i].sent = &commands[i];
+		list[i].sentSize = 1;
+		list[i].received = &_received[offset];
+		list[i].receivedSize = length + plan.safe;
+		list[i].crc = (plan.safe == SAFE_high) ? &crc[i] : NULL;
+		offset += length + plan.safe;
+	}
+	sBus->sendReceiveList(list, plan.numBursts);
+
+	offset = 0;
+	for (uint8_t i = 0; i < plan.numBursts; i++)
+	{
+		uint16_t length = plan.bursts[i].command & 0x000F;
+		if (plan.safe == SAFE_high)
+		{
+			status = checkSafetyCrc(_received[offset + length], crcFinal(crc[i]));
+			if (status != NO_ERROR)
+			{
+				return (status);
+			}
+		}
+		memcpy(&reg.regMap[plan.bursts[i].pos], &_received[offset], length * sizeof(uint16_t));
+		if (plan.safe == SAFE_high)
+		{
+			reg.validateCache(((1UL << length) - 1) << plan.bursts[i].pos);
+		}
+		offset += length + plan.safe;
+	}
+	return (status);
+}
+
+errorTypes Tle5012b::readRegisters(uint32_t regMask, updTypes upd, safetyTypes safe)
+{
+	readPlan plan;
+	planRead(regMask, plan, upd, safe);
+	return (readPlanned(plan));
+}
+// end burst planner functions
+
+
 //-----------------------------------------------------------------------------
 // begin write functions
 errorTypes Tle5012b::writeIntMode2(uint16_t dataToWrite)
@@ -600,10 +967,7 @@ errorTypes Tle5012b::readRegMap()
 	errorTypes status;
 
 	sBus->triggerUpdate();
-	for (int8_t i = 0; i < MAX_NUM_REG; i++)
-	{
-		status = readFromSensor(reg.addrFields[i].regAddress, reg.regMap[i], UPD_low, SAFE_high);
-	}
+	status = readRegisters(Reg::MASK_ALL, UPD_low, SAFE_high);
 
 	return (status);
 }
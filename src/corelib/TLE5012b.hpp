@@ -19,6 +19,7 @@
 #include "../pal/spic.hpp"
 #include "tle5012b_util.hpp"
 #include "tle5012b_reg.hpp"
+#include "tle5012b_crc.hpp"
 
 /**
  * @addtogroup tle5012api
@@ -85,6 +86,95 @@ class Tle5012b
 			}
 		} safetyWord_t;
 
+		/*!
+		* \brief Decoded motion registers AVAL, ASPD, AREV and FSYNC
+		* which are fetched together with one burst read and one safety word.
+		* All values are the raw sensor values, sign extended where needed.
+		*/
+		struct motionSnapshot {
+			int16_t  rawAngle;       //!< \brief AVAL bits 14:0 signed angle value
+			int16_t  rawSpeed;       //!< \brief ASPD bits 14:0 signed angle speed
+			int16_t  revolutions;    //!< \brief AREV bits 8:0 signed number of revolutions
+			int16_t  rawTemp;        //!< \brief FSYNC bits 8:0 signed temperature value
+			uint8_t  frameCounter;   //!< \brief AREV bits 14:9 internal frame counter
+			uint8_t  frameSync;      //!< \brief FSYNC bits 15:9 frame synchronization counter
+
+			/*!
+			* \brief Decodes the registers of a burst read
+			* @param [in,out] rawData AVAL, ASPD, AREV and FSYNC as read, sign extended in place
+			*/
+			void decode(uint16_t rawData[]);
+
+			/*!
+			* \brief Returns the angle value in Q16 turns, exact
+			* @return angle value from the raw angle, 65536 is one turn
+			*/
+			int32_t angleQ16()
+			{
+				return ((int32_t) rawAngle * ANGLE_Q16_FACTOR);
+			}
+
+#if (TLE5012_DOUBLE_API == 1)
+			/*!
+			* \brief Returns the angle value in degree
+			* @return angle value from the raw angle
+			*/
+			double angle()
+			{
+				return ((ANGLE_360_VAL / POW_2_15) * ((double) rawAngle));
+			}
+
+			/*!
+			* \brief Returns the temperature in °C
+			* @return temperature from the raw temperature
+			*/
+			double temperature()
+			{
+				return ((rawTemp + TEMP_OFFSET) / (TEMP_DIV));
+			}
+#endif
+		};
+
+		/*!
+		* \brief Register sets needed for the calculated values, combine them
+		* with | and with Reg::RegMask_t to plan one read of all of them
+		*/
+		enum readQuantity
+		{
+			QUANTITY_ANGLE       = Reg::MASK_AVAL,                                      //!< \brief angle value
+			QUANTITY_SPEED       = Reg::MASK_ASPD | Reg::MASK_MOD_1 | Reg::MASK_MOD_2,  //!< \brief angle speed with FIR_MD, prediction and angle range
+			QUANTITY_REVOLUTIONS = Reg::MASK_AREV,                                      //!< \brief number of revolutions and frame counter
+			QUANTITY_TEMPERATURE = Reg::MASK_FSYNC,                                     //!< \brief temperature
+			QUANTITY_RANGE       = Reg::MASK_MOD_2                                      //!< \brief angle range
+		};
+
+		/*!
+		* \brief Read plan with the fewest burst reads for a set of registers.
+		* Registers with contiguous addresses are merged into one burst of max
+		* MAX_BURST_LENGTH registers, and gaps of up to MAX_PLAN_GAP not
+		* requested registers are read along when this saves bus words.
+		*/
+		struct readPlan {
+			struct burst {
+				uint16_t command;            //!< \brief register address and number of registers
+				uint8_t  pos;                //!< \brief regMap position of the first register
+			} bursts[MAX_PLAN_BURSTS];       //!< \brief planned burst reads
+			uint8_t     numBursts;           //!< \brief number of planned burst reads
+			uint16_t    words;               //!< \brief bus words of the plan
+			uint16_t    singleWords;         //!< \brief bus words with one read for each requested register
+			updTypes    upd;                 //!< \brief read from update buffer or directly
+			safetyTypes safe;                //!< \brief with or without safety word
+
+			/*!
+			* \brief Returns the bus words saved against one read for each register
+			* @return number of saved 16 bit words
+			*/
+			uint16_t wordsSaved()
+			{
+				return (singleWords - words);
+			}
+		};
+
 		//!< \brief constructor for the Sensor
 		Tle5012b();
 
@@ -155,6 +245,29 @@ class Tle5012b
 		*/
 		errorTypes readMoreRegisters(uint16_t command, uint16_t data[], updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
 
+		/*!
+		* Same as readMoreRegisters, but the SPI bus writes directly into the caller buffer,
+		* followed by the safety word, which is checked in place. There is no copy and no
+		* temporary buffer, so the buffer must hold the number of registers + 1 words with
+		* SAFE_high. A zero register count reads one register as readMoreRegisters does.
+		* @param [in] command the command for reading, register address and number of registers
+		* @param [out] buffer the read registers followed by the safety word
+		* @param [in] bufferLength number of words of buffer
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type, BUFFER_SIZE_ERROR if the buffer is too small
+		*/
+		errorTypes readBurst(uint16_t command, uint16_t buffer[], uint16_t bufferLength, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+		/*!
+		* Checks the safety word of a transfer which ran outside of this class,
+		* e.g. on an asynchronous bus, like the own reads do
+		* @param [in] safety the received safety word
+		* @param [in] crc CRC context of the command and the data words, see SPIC::Command_t
+		* @return CRC error type
+		*/
+		errorTypes checkTransfer(uint16_t safety, crc8Ctx_t crc);
+
 		/*!
 		* This functions reads the main status word for the sensor,
 		* mainly for checking with the additional safety word
@@ -212,6 +325,7 @@ class Tle5012b
 		*/
 		errorTypes readRawY(int16_t &data);
 
+#if (TLE5012_DOUBLE_API == 1)
 		/*!
 		* Returns the Angle Range
 		* Angle Range is stored in bytes 14 - 4 of MOD_2.
@@ -236,6 +350,18 @@ class Tle5012b
 		* @return CRC error type
 		*/
 		errorTypes getAngleValue(double &angleValue, int16_t &rawAnglevalue, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+#endif
+
+		/*!
+		* Returns the angle value in Q16 turns without floating point arithmetic.
+		* The 15 bit signed raw value is 1/32768 turn, so the result is exact
+		* and 65536 is one turn, e.g. 90° is 16384.
+		* @param [in,out] angleQ16 angle value in Q16 turns, -32768 to 32766, +-half a turn
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type
+		*/
+		errorTypes getAngleQ16(int32_t &angleQ16, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
 
 		/*!
 		* Returns the number of revolutions done from the angle value which is a 9 bit signed integer.
@@ -249,6 +375,7 @@ class Tle5012b
 		*/
 		errorTypes getNumRevolutions(int16_t &numRev, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
 
+#if (TLE5012_DOUBLE_API == 1)
 		/*!
 		* Return the temperature.
 		* The temperature value is a 9 bit signed integer.
@@ -267,10 +394,25 @@ class Tle5012b
 		*/
 		errorTypes getTemperature(double &temp, int16_t &rawTemp, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
 
+#endif
+
+		/*!
+		* Returns the temperature in Q8 °C without floating point arithmetic,
+		* i.e. 256 is 1 °C. The result is within 1/256 °C of getTemperature.
+		* @param [in,out] temperatureQ8 temperature in 1/256 °C
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type
+		*/
+		errorTypes getTemperatureQ8(int32_t &temperatureQ8, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+#if (TLE5012_DOUBLE_API == 1)
 		/*!
 		* Returns the calculated angle speed.
 		* The angle speed is a 15 bit signed integer,
 		* however, the register returns 16 bits, so we need to do some bit arithmetic.
+		* Only ASPD is read, it is multiplied with the speed scale which is calculated
+		* from FIR_MD, prediction and angle range when MOD_1 or MOD_2 change.
 		* @param [in,out] angleSpeed pointer to 16bit double value
 		* @return CRC error type
 		*/
@@ -284,6 +426,63 @@ class Tle5012b
 		* @return CRC error type
 		*/
 		errorTypes getAngleSpeed(double &angleSpeed,int16_t &rawSpeed, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+#endif
+
+		/*!
+		* Returns the angle speed in centi-degree per second without floating point
+		* arithmetic. All factors of the speed formula are integers when the FIR_MD
+		* update time is taken in 0.1 µs, they are kept as one 31 bit fixed-point
+		* scale, so the result is within 0.5 cdeg/s plus 2^-31 of getAngleSpeed
+		* and saturated to +-0x7FFFFFFF.
+		* @param [in,out] speedCdeg angle speed in 1/100 °/s
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type
+		*/
+		errorTypes getAngleSpeedCdeg(int32_t &speedCdeg, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+		/*!
+		* Reads angle value, angle speed, number of revolutions, frame counter and temperature
+		* with one burst read of the registers AVAL, ASPD, AREV and FSYNC, so there is only one
+		* chip select cycle and one safety word check instead of four.
+		* With UPD_high all values are fetched from the update buffer and therefore
+		* belong to the same point of time. Call sBus->triggerUpdate() before to
+		* take the snapshot of this point of time.
+		* @param [out] snapshot the decoded motion registers
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type
+		*/
+		errorTypes readMotionSnapshot(motionSnapshot &snapshot, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+		/*!
+		* Plans the burst reads for a set of registers, see readPlan.
+		* @param [in] regMask set of registers, combination of Reg::RegMask_t and readQuantity
+		* @param [out] plan the planned burst reads
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		*/
+		void planRead(uint32_t regMask, readPlan &plan, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+		/*!
+		* Executes a read plan and stores all read registers in reg.regMap.
+		* A plan can be executed as often as needed, e.g. once per control loop.
+		* All bursts run as one command list, see SPIC::sendReceiveList, and only the
+		* bursts before the first failed safety word are stored.
+		* @param [in] plan the plan from planRead
+		* @return CRC error type of the first failed burst
+		*/
+		errorTypes readPlanned(const readPlan &plan);
+
+		/*!
+		* Plans and executes the burst reads for a set of registers in one call.
+		* All read registers are stored in reg.regMap.
+		* @param [in] regMask set of registers, combination of Reg::RegMask_t and readQuantity
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type
+		*/
+		errorTypes readRegisters(uint32_t regMask, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
 
 		/*!
 		* Function sets the SNR register with the correct slave number
@@ -336,6 +535,29 @@ class Tle5012b
 		*/
 		errorTypes resetFirmware();
 
+		/*!
+		* Switches on the local CRC mode. In this mode the values of the CRC registers
+		* 08 - 0F are kept from all writes, so the CRC_PAR update after a configuration
+		* write is calculated without reading the register block from the sensor.
+		* The block is only read at begin(), after resets and write errors.
+		*/
+		void enableLocalCrc();
+
+		/*!
+		* Switches off the local CRC mode, so the register block is read
+		* from the sensor before each CRC_PAR update (default).
+		*/
+		void disableLocalCrc();
+
+		/*!
+		* Health check for the local CRC mode, call it from time to time when the
+		* bus is idle. Reads the CRC registers 08 - 0F, checks the CRC_PAR of the sensor
+		* against its registers and the local copy against the sensor values.
+		* The local copy is updated with the sensor values afterwards.
+		* @return CRC_ERROR if the CRC_PAR or the local copy was wrong, else the CRC error type of the read
+		*/
+		errorTypes checkCrcShadow();
+
 		/*!
 		* Function reads all readable sensor registers
 		* and separates the information fields. This function
@@ -364,11 +586,28 @@ class Tle5012b
 		*/
 		errorTypes setCalibration(Reg::calibrationMode_t calMode);
 
+		/*!
+		* Drops the cached angle speed scale, so it is calculated again from MOD_1
+		* and MOD_2 on the next speed read. Is called by the register cache when
+		* MOD_1 or MOD_2 are written, read again or invalidated.
+		*/
+		void invalidateSpeedScale();
+
 	protected:
 
+		friend class Reg;                          //!< \brief Reg::commit updates CRC_PAR after a failed write
+
 		uint16_t _command[2];                      //!< \brief  command write data [0] = command [1] = data to write
 		uint16_t _received[MAX_REGISTER_MEM];      //!< \brief fetched data from sensor with last word = safety word
 		uint16_t _registers[CRC_NUM_REGISTERS+1];  //!< \brief keeps track of the values stored in the 8 _registers, for which the CRC is calculated
+		bool     _localCrc;                        //!< \brief CRC_PAR is calculated from _registers without reading them first
+		bool     _crcShadowValid;                  //!< \brief _registers holds the actual sensor values
+		bool     _speedScaleValid;                 //!< \brief speed scale matches the actual MOD_1 and MOD_2
+#if (TLE5012_DOUBLE_API == 1)
+		double   _speedScale;                      //!< \brief angle speed in °/s per raw speed step
+#endif
+		uint32_t _speedScaleQ;                     //!< \brief angle speed in cdeg/s per raw speed step, scaled by 2^_speedScaleShift
+		uint8_t  _speedScaleShift;                 //!< \brief fractional bits of _speedScaleQ
 
 		/*!
 		* This function is called each time any register in the
@@ -390,6 +629,14 @@ class Tle5012b
 		*/
 		errorTypes checkSafety(uint16_t safety, uint16_t command, uint16_t* readreg, uint16_t length);
 
+		/*!
+		* Same as checkSafety, but with the CRC calculated while receiving, see SPIC::sendReceiveCrc
+		* @param safety register with the CRC check data
+		* @param crc CRC of the command word and the data words
+		* @return CRC error type
+		*/
+		errorTypes checkSafetyCrc(uint16_t safety, uint8_t crc);
+
 		/*!
 		* When an error occurs in the safety word, the error bit remains 0(error),
 		* until the status register is read again. Flushes out safety errors,
@@ -399,6 +646,40 @@ class Tle5012b
 		*/
 		void resetSafety();
 
+		/*!
+		* Invalidates the register cache after a write to the sensor. The written
+		* register is read again on the next access, resets and the fuse reload
+		* invalidate all registers.
+		* @param [in] command the command of the write
+		* @param [in] dataToWrite the written data
+		*/
+		void invalidateWritten(uint16_t command, uint16_t dataToWrite);
+
+		/*!
+		* Keeps the copy of the CRC registers 08 - 0F in _registers up to date after a write
+		* @param [in] command the command or register address of the write
+		* @param [in] dataToWrite the written data
+		* @param [in] status CRC error type of the write
+		*/
+		void updateCrcShadow(uint16_t command, uint16_t dataToWrite, errorTypes status);
+
+		/*!
+		* Calculates the angle speed scale in double and fixed-point from MOD_1 and
+		* MOD_2, which are served from the register cache or read once
+		* @return CRC error type
+		*/
+		errorTypes updateSpeedScale();
+
+		/*!
+		* Reads the sign extended raw angle speed from ASPD, the speed scale
+		* is updated before if needed
+		* @param [in,out] rawSpeed raw angle speed
+		* @param [in] upd read from update (UPD_high) register or directly (UPD_low)
+		* @param [in] safe generate safety word (SAFE_high) or no (SAFE_low)
+		* @return CRC error type
+		*/
+		errorTypes readRawSpeed(int16_t &rawSpeed, updTypes upd, safetyTypes safe);
+
 };
 
 /**
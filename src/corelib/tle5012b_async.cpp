@@ -0,0 +1,156 @@
+/*!
+ * \file        tle5012b_async.cpp
+ * \name        tle5012b_async.cpp - asynchronous reads of the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012async
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_async.hpp"
+
+#if (TLE5012_SPIC_ASYNC == 1)
+
+Tle5012Async::Tle5012Async(Tle5012b &sensor, SPICQueue &queue)
+{
+	this->sensor = &sensor;
+	this->queue = &queue;
+	for (uint8_t i = 0; i < TLE5012_SPIC_QUEUE_DEPTH; i++)
+	{
+		slots[i].state = SLOT_FREE;
+	}
+}
+
+Tle5012Async::token_t Tle5012Async::readAsync(uint16_t command, updTypes upd)
+{
+	uint8_t length = command & 0x000F;
+	if ((length == 0) || (length > ASYNC_MAX_REGISTERS))
+	{
+		return (ASYNC_NO_TOKEN);
+	}
+	for (uint8_t i = 0; i < TLE5012_SPIC_QUEUE_DEPTH; i++)
+	{
+		slot &s = slots[i];
+		if (__atomic_load_n(&s.state, __ATOMIC_ACQUIRE) != SLOT_FREE)
+		{
+			continue;
+		}
+		s.command = READ_SENSOR | command | upd;
+		s.transfer.sent = &s.command;
+		s.transfer.sentSize = 1;
+		s.transfer.received = s.data;
+		s.transfer.receivedSize = length + 1;
+		s.transfer.crc = &s.crc;
+		crcInit(s.crc, s.command);
+		s.state = SLOT_PENDING;
+		SPICQueue::Request_t request = { &s.transfer, 1 };
+		if (queue->submit(request, done, &s) != SPIC::OK)
+		{
+			s.state = SLOT_FREE;
+			return (ASYNC_NO_TOKEN);
+		}
+		return ((token_t) i);
+	}
+	return (ASYNC_NO_TOKEN);
+}
+
+Tle5012Async::token_t Tle5012Async::getAngleAsync(updTypes upd)
+{
+	return (readAsync(sensor->reg.REG_AVAL + 1, upd));
+}
+
+Tle5012Async::token_t Tle5012Async::getMotionAsync(updTypes upd)
+{
+	return (readAsync(sensor->reg.REG_AVAL + MOTION_NUM_REGISTERS, upd));
+}
+
+bool Tle5012Async::isDone(token_t token)
+{
+	if ((token < 0) || (token >= TLE5012_SPIC_QUEUE_DEPTH))
+	{
+		return (false);
+	}
+	return (__atomic_load_n(&slots[token].state, __ATOMIC_ACQUIRE) == SLOT_DONE);
+}
+
+errorTypes Tle5012Async::finish(token_t token)
+{
+	if ((token < 0) || (token >= TLE5012_SPIC_QUEUE_DEPTH) || (slots[token].state == SLOT_FREE))
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	slot &s = slots[token];
+	while (__atomic_load_n(&s.state, __ATOMIC_ACQUIRE) != SLOT_DONE)
+	{
+	}
+	if (s.status != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	return (sensor->checkTransfer(s.data[s.transfer.receivedSize - 1], s.crc));
+}
+
+errorTypes Tle5012Async::takeData(token_t token, uint16_t data[], uint8_t length)
+{
+	if ((token < 0) || (token >= TLE5012_SPIC_QUEUE_DEPTH) || (slots[token].state == SLOT_FREE))
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	// the size is set before the submit, a too small buffer keeps the read for a retry
+	slot &s = slots[token];
+	uint8_t registers = s.transfer.receivedSize - 1;
+	if (length < registers)
+	{
+		return (BUFFER_SIZE_ERROR);
+	}
+	errorTypes status = finish(token);
+	if (status == NO_ERROR)
+	{
+		memcpy(data, s.data, registers * sizeof(uint16_t));
+	}
+	__atomic_store_n(&s.state, (uint8_t) SLOT_FREE, __ATOMIC_RELEASE);
+	return (status);
+}
+
+errorTypes Tle5012Async::takeAngleQ16(token_t token, int32_t &angleQ16)
+{
+	uint16_t rawData = 0;
+	errorTypes status = takeData(token, &rawData, 1);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	rawData = (rawData & (DELETE_BIT_15));
+	//check if the value received is positive or negative
+	if (rawData & CHECK_BIT_14)
+	{
+		rawData = rawData - CHANGE_UINT_TO_INT_15;
+	}
+	angleQ16 = (int32_t) ((int16_t) rawData) * ANGLE_Q16_FACTOR;
+	return (status);
+}
+
+errorTypes Tle5012Async::takeMotion(token_t token, Tle5012b::motionSnapshot &snapshot)
+{
+	uint16_t rawData[MOTION_NUM_REGISTERS];
+	errorTypes status = takeData(token, rawData, MOTION_NUM_REGISTERS);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	snapshot.decode(rawData);
+	return (status);
+}
+
+void Tle5012Async::done(SPIC::Error_t status, void *context)
+{
+	slot *s = (slot *) context;
+	s->status = (uint8_t) status;
+	__atomic_store_n(&s->state, (uint8_t) SLOT_DONE, __ATOMIC_RELEASE);
+}
+
+#endif /* TLE5012_SPIC_ASYNC */
@@ -0,0 +1,157 @@
+/*!
+ * \file        tle5012b_async.hpp
+ * \name        tle5012b_async.hpp - asynchronous reads of the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              Front-end of Tle5012b for an asynchronous bus. The reads are submitted to a
+ *              SPICQueue and return a token at once, the caller goes on, e.g. with the control
+ *              math of the last angle, and takes the result with the token later. Taking a
+ *              result waits until it is done and checks the safety word like the blocking reads.
+ *              There is one token for each queue entry, so TLE5012_SPIC_QUEUE_DEPTH reads can
+ *              be in flight. With a blocking bus the reads are done when they return, so the
+ *              same code runs on all platforms.
+ * \ref         tle5012async
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_ASYNC_HPP
+#define TLE5012B_ASYNC_HPP
+
+#include <stdint.h>
+#include "TLE5012b.hpp"
+#include "../pal/spic-queue.hpp"
+
+#if (TLE5012_SPIC_ASYNC == 1)
+
+/**
+ * @addtogroup tle5012async
+ *
+ * @{
+ */
+
+#define ASYNC_MAX_REGISTERS    MOTION_NUM_REGISTERS    //!< \brief max registers of one asynchronous read
+#define ASYNC_NO_TOKEN         (-1)                    //!< \brief returned if no token or queue entry is free
+
+/*!
+ * Asynchronous reads with tokens
+ */
+class Tle5012Async
+{
+	public:
+
+		typedef int8_t token_t;      //!< \brief handle of a submitted read
+
+		/*!
+		* Constructor
+		* @param [in,out] sensor sensor of the reads, checks the safety words
+		* @param [in,out] queue request queue of the bus of the sensor
+		*/
+		Tle5012Async(Tle5012b &sensor, SPICQueue &queue);
+
+		/*!
+		* Submits a burst read with safety word
+		* @param [in] command register address and number of registers, 1 to ASYNC_MAX_REGISTERS
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @return token of the read, ASYNC_NO_TOKEN if all are in use or the queue is full
+		*/
+		token_t readAsync(uint16_t command, updTypes upd=UPD_low);
+
+		/*!
+		* Submits a read of AVAL
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @return token of the read, take it with takeAngleQ16
+		*/
+		token_t getAngleAsync(updTypes upd=UPD_low);
+
+		/*!
+		* Submits a burst read of AVAL, ASPD, AREV and FSYNC
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @return token of the read, take it with takeMotion
+		*/
+		token_t getMotionAsync(updTypes upd=UPD_low);
+
+		/*!
+		* Checks a read without waiting
+		* @param [in] token token of the read
+		* @return true if the read is done and can be taken
+		*/
+		bool isDone(token_t token);
+
+		/*!
+		* Takes the registers of a read and frees the token, waits until the read is done.
+		* If data is too small, the token stays valid, so the read can be taken again.
+		* @param [in] token token of the read
+		* @param [out] data registers of the read
+		* @param [in] length number of words of data
+		* @return CRC error type, INTERFACE_ACCESS_ERROR for a wrong token or a failed
+		* transfer, BUFFER_SIZE_ERROR if data is too small
+		*/
+		errorTypes takeData(token_t token, uint16_t data[], uint8_t length);
+
+		/*!
+		* Takes the angle of a getAngleAsync read, see takeData
+		* @param [in] token token of the read
+		* @param [out] angleQ16 angle in Q16 turns, 65536 is one turn
+		* @return CRC error type
+		*/
+		errorTypes takeAngleQ16(token_t token, int32_t &angleQ16);
+
+		/*!
+		* Takes the values of a getMotionAsync read, see takeData
+		* @param [in] token token of the read
+		* @param [out] snapshot decoded motion registers
+		* @return CRC error type
+		*/
+		errorTypes takeMotion(token_t token, Tle5012b::motionSnapshot &snapshot);
+
+	private:
+
+		//!< \brief token states
+		enum slotState
+		{
+			SLOT_FREE = 0,
+			SLOT_PENDING,
+			SLOT_DONE
+		};
+
+		/*!
+		* \brief One read in flight with its buffers
+		*/
+		struct slot
+		{
+			uint16_t        command;                             //!< \brief command word
+			uint16_t        data[ASYNC_MAX_REGISTERS + 1];       //!< \brief registers and safety word
+			crc8Ctx_t       crc;                                 //!< \brief CRC of the command and the registers
+			SPIC::Command_t transfer;                            //!< \brief command of the queue request
+			uint8_t         state;                               //!< \brief slotState, written by both sides
+			uint8_t         status;                              //!< \brief SPIC error code of the transfer
+		};
+
+		Tle5012b  *sensor;
+		SPICQueue *queue;
+		slot       slots[TLE5012_SPIC_QUEUE_DEPTH];
+
+		/*!
+		* Waits for a read and checks its safety word
+		* @param [in] token token of the read
+		* @return CRC error type
+		*/
+		errorTypes finish(token_t token);
+
+		/*!
+		* Completion of a read, may run in an interrupt or on a worker thread
+		*/
+		static void done(SPIC::Error_t status, void *context);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012_SPIC_ASYNC */
+#endif /* TLE5012B_ASYNC_HPP */
@@ -0,0 +1,233 @@
+/*!
+ * \file        tle5012b_bus.cpp
+ * \name        tle5012b_bus.cpp - round-robin scheduler for several TLE5012B on one bus.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012bus
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_bus.hpp"
+
+Tle5012bBus::Tle5012bBus(Timer &timer)
+{
+	this->timer = &timer;
+	count = 0;
+	first = 0;
+	callback = NULL;
+	context = NULL;
+	statsStart = 0;
+	busyTime = 0;
+	maxSkew = 0;
+	acquisitions = 0;
+	for (uint8_t i = 0; i < BUS_MAX_SENSORS; i++)
+	{
+		slots[i].sensor = NULL;
+		slots[i].period = 0;
+		slots[i].nextTime = 0;
+		slots[i].nextIndex = 0;
+		stats[i].samples = 0;
+		stats[i].missed = 0;
+		stats[i].errors = 0;
+	}
+}
+
+int8_t Tle5012bBus::addSensor(Tle5012b &sensor, uint32_t periodMicro)
+{
+	if (count >= BUS_MAX_SENSORS)
+	{
+		return (BUS_NO_SENSOR);
+	}
+	slots[count].sensor = &sensor;
+	slots[count].period = periodMicro;
+	slots[count].nextTime = now();
+	slots[count].nextIndex = 0;
+	return ((int8_t) count++);
+}
+
+void Tle5012bBus::setRate(uint8_t index, uint32_t periodMicro)
+{
+	if (index >= count)
+	{
+		return;
+	}
+	slots[index].period = periodMicro;
+	slots[index].nextTime = now();
+}
+
+void Tle5012bBus::setCallback(sampleFunc_t func, void *context)
+{
+	callback = func;
+	this->context = context;
+}
+
+void Tle5012bBus::begin()
+{
+	timer->start();
+	uint32_t time = now();
+	for (uint8_t i = 0; i < count; i++)
+	{
+		slots[i].nextTime = time;
+		slots[i].nextIndex = 0;
+	}
+	first = 0;
+	acquisitions = 0;
+	resetStats();
+}
+
+uint32_t Tle5012bBus::now()
+{
+	uint32_t time = 0;
+	timer->elapsedMicro(time);
+	return (time);
+}
+
+/*!
+* The sensors due at the start of the call are read, a sensor which gets due
+* during the reads waits for the next call. The first sensor moves on with
+* every call, so the place right after the timestamp goes round.
+*/
+uint8_t Tle5012bBus::service()
+{
+	uint32_t time = now();
+	uint8_t samples = 0;
+	for (uint8_t k = 0; k < count; k++)
+	{
+		uint8_t i = (uint8_t) ((first + k) % count);
+		if ((slots[i].period != 0) && ((int32_t) (time - slots[i].nextTime) >= 0))
+		{
+			read(i);
+			samples++;
+		}
+	}
+	if (samples > 0)
+	{
+		first = (uint8_t) ((first + 1) % count);
+	}
+	return (samples);
+}
+
+uint8_t Tle5012bBus::next()
+{
+	uint32_t time = now();
+	int32_t wait = INT32_MAX;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		int32_t due = (int32_t) (slots[i].nextTime - time);
+		if ((slots[i].period != 0) && (due < wait))
+		{
+			wait = due;
+		}
+	}
+	if (wait == INT32_MAX)
+	{
+		return (0);
+	}
+	if (wait > 0)
+	{
+		timer->delayMicro((uint32_t) wait);
+	}
+	return (service());
+}
+
+void Tle5012bBus::read(uint8_t index)
+{
+	slot &s = slots[index];
+	sample smp;
+	uint32_t time = now();
+	// more than one period late, continue on the grid like the Tle5012Sampler
+	uint32_t late = time - s.nextTime;
+	if (((int32_t) late > 0) && (late >= s.period))
+	{
+		uint32_t skipped = late / s.period;
+		stats[index].missed += skipped;
+		s.nextIndex += skipped;
+		s.nextTime += skipped * s.period;
+	}
+
+	smp.sensor = index;
+	smp.index = s.nextIndex;
+	smp.time = time;
+	smp.status = s.sensor->readMotionSnapshot(smp.motion);
+	smp.latency = now() - time;
+	busyTime += smp.latency;
+	stats[index].samples++;
+	if (smp.status != NO_ERROR)
+	{
+		stats[index].errors++;
+	}
+	s.nextIndex++;
+	s.nextTime += s.period;
+	if (callback != NULL)
+	{
+		callback(smp, context);
+	}
+}
+
+/*!
+* The skew is taken from the timestamps before each trigger, so it also holds
+* the time of a SPIC which sends the whole trigger in triggerUpdateBegin.
+*/
+errorTypes Tle5012bBus::acquire(sample samples[], uint32_t &skewMicro)
+{
+	for (uint8_t i = 0; i < count; i++)
+	{
+		samples[i].time = now();
+		slots[i].sensor->sBus->triggerUpdateBegin();
+	}
+	timer->delayMicro(BUS_TRIGGER_US);
+	for (uint8_t i = 0; i < count; i++)
+	{
+		slots[i].sensor->sBus->triggerUpdateEnd();
+	}
+	skewMicro = (count > 0) ? samples[count - 1].time - samples[0].time : 0;
+	maxSkew = (skewMicro > maxSkew) ? skewMicro : maxSkew;
+
+	errorTypes status = NO_ERROR;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		sample &smp = samples[i];
+		uint32_t time = now();
+		smp.sensor = i;
+		smp.index = acquisitions;
+		smp.status = slots[i].sensor->readMotionSnapshot(smp.motion, UPD_high);
+		smp.latency = now() - time;
+		busyTime += smp.latency;
+		stats[i].samples++;
+		if (smp.status != NO_ERROR)
+		{
+			stats[i].errors++;
+			status = (status == NO_ERROR) ? smp.status : status;
+		}
+	}
+	acquisitions++;
+	return (status);
+}
+
+uint16_t Tle5012bBus::utilization()
+{
+	uint32_t elapsed = now() - statsStart;
+	if (elapsed == 0)
+	{
+		return (0);
+	}
+	uint64_t permille = (busyTime * 1000) / elapsed;
+	return ((uint16_t) ((permille < 1000) ? permille : 1000));
+}
+
+void Tle5012bBus::resetStats()
+{
+	for (uint8_t i = 0; i < BUS_MAX_SENSORS; i++)
+	{
+		stats[i].samples = 0;
+		stats[i].missed = 0;
+		stats[i].errors = 0;
+	}
+	busyTime = 0;
+	maxSkew = 0;
+	statsStart = now();
+}
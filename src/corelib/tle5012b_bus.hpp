@@ -0,0 +1,179 @@
+/*!
+ * \file        tle5012b_bus.hpp
+ * \name        tle5012b_bus.hpp - round-robin scheduler for several TLE5012B on one bus.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              Up to four sensors TLE5012B_S0 to TLE5012B_S3 share one SSC bus, each with its
+ *              own chip select. The scheduler reads every sensor at its own period on the Timer
+ *              PAL, with the same fixed time grid as the Tle5012Sampler. The sensors which are
+ *              due are read back to back with one burst each, in round-robin order, so one
+ *              sensor cannot starve the others when the bus is overloaded. Every sample is a
+ *              motion snapshot with its timestamp and goes to a callback. The bus time of the
+ *              reads gives the bus utilization.
+ *              For values of the same instant, e.g. the twist of a shaft between two sensors,
+ *              acquire triggers the update buffers of all sensors back to back, or at the same
+ *              time where the SPIC can hold the trigger, and reads them with UPD_high.
+ * \ref         tle5012bus
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_BUS_HPP
+#define TLE5012B_BUS_HPP
+
+#include <stdint.h>
+#include "TLE5012b.hpp"
+#include "../pal/timer.hpp"
+
+/**
+ * @addtogroup tle5012bus
+ *
+ * @{
+ */
+
+#define BUS_MAX_SENSORS    4       //!< \brief sensors on one bus, one for each slave number
+#define BUS_NO_SENSOR      (-1)    //!< \brief returned by addSensor if the bus is full
+#define BUS_TRIGGER_US     5       //!< \brief grace period of the register snapshot while the triggers are held
+
+/*!
+ * Scheduler of the reads of up to four sensors on one bus
+ */
+class Tle5012bBus
+{
+	public:
+
+		struct sample {
+			uint8_t    sensor;       //!< \brief index of the sensor as returned by addSensor
+			uint32_t   index;        //!< \brief number of the period of this sensor since begin, or of the acquire call
+			uint32_t   time;         //!< \brief start of the read in us since begin, or of the trigger for acquire
+			uint32_t   latency;      //!< \brief duration of the read in us
+			Tle5012b::motionSnapshot motion;  //!< \brief angle, speed, revolutions and frame counters
+			errorTypes status;       //!< \brief error of the read
+		};
+
+		/*!
+		* Receives the samples
+		* @param [in] s the sample
+		* @param [in] context as given to setCallback
+		*/
+		typedef void (*sampleFunc_t)(const sample &s, void *context);
+
+		/*!
+		* \brief Counters of one sensor
+		*/
+		struct sensorStats {
+			uint32_t   samples;      //!< \brief samples read
+			uint32_t   missed;       //!< \brief periods skipped because the sensor was late for more than one period
+			uint32_t   errors;       //!< \brief samples with an error
+		};
+
+		sensorStats stats[BUS_MAX_SENSORS];    //!< \brief counters by sensor index
+		uint32_t    maxSkew;                   //!< \brief largest trigger skew of acquire in us
+
+		/*!
+		* Constructor of the scheduler
+		* @param [in] timer timer with a microsecond clock, see Timer::elapsedMicro
+		*/
+		Tle5012bBus(Timer &timer);
+
+		/*!
+		* Adds a sensor on the bus, it must be started with begin before
+		* @param [in] sensor sensor to read
+		* @param [in] periodMicro read period in us, 0 to pause the sensor
+		* @return index of the sensor, BUS_NO_SENSOR if there are already four
+		*/
+		int8_t addSensor(Tle5012b &sensor, uint32_t periodMicro);
+
+		/*!
+		* Changes the read period of a sensor, it is next read at once
+		* @param [in] index index of the sensor
+		* @param [in] periodMicro read period in us, 0 to pause the sensor
+		*/
+		void setRate(uint8_t index, uint32_t periodMicro);
+
+		/*!
+		* Sets the receiver of the samples
+		* @param [in] func called for each sample, NULL for none
+		* @param [in] context passed to func
+		*/
+		void setCallback(sampleFunc_t func, void *context);
+
+		/*!
+		* Starts the timer and the sampling grids, all sensors are due right away
+		*/
+		void begin();
+
+		/*!
+		* Reads the sensors which are due without waiting
+		* @return number of samples read
+		*/
+		uint8_t service();
+
+		/*!
+		* Waits until the next sensor is due and reads the sensors which are due then
+		* @return number of samples read
+		*/
+		uint8_t next();
+
+		/*!
+		* Takes a snapshot of all sensors at the same instant. The triggers are started
+		* one after the other with SPIC::triggerUpdateBegin, held for BUS_TRIGGER_US and
+		* ended, then every sensor is read from its update buffer. Does not change the
+		* schedule and does not call the callback.
+		* @param [out] samples one sample per sensor by index, time is the start of its trigger
+		* @param [out] skewMicro time from the first to the last trigger in us
+		* @return the first error of the reads
+		*/
+		errorTypes acquire(sample samples[], uint32_t &skewMicro);
+
+		/*!
+		* Share of the time since begin or resetStats the bus was busy with reads
+		* @return utilization in 1/1000
+		*/
+		uint16_t utilization();
+
+		/*!
+		* Clears the counters, the utilization and the largest skew
+		*/
+		void resetStats();
+
+	private:
+
+		/*!
+		* \brief Schedule of one sensor
+		*/
+		struct slot {
+			Tle5012b  *sensor;
+			uint32_t   period;       //!< \brief read period in us, 0 if paused
+			uint32_t   nextTime;     //!< \brief scheduled time of the next read
+			uint32_t   nextIndex;    //!< \brief period number of the next read
+		};
+
+		Timer        *timer;
+		slot          slots[BUS_MAX_SENSORS];
+		uint8_t       count;         //!< \brief number of sensors
+		uint8_t       first;         //!< \brief sensor which is checked first on the next service
+		sampleFunc_t  callback;
+		void         *context;
+		uint32_t      statsStart;    //!< \brief time of begin or resetStats
+		uint64_t      busyTime;      //!< \brief sum of the read latencies in us
+		uint32_t      acquisitions;  //!< \brief number of acquire calls since begin
+
+		uint32_t      now();
+
+		/*!
+		* Reads one sensor and moves its schedule to the next period
+		* @param [in] index index of the sensor
+		*/
+		void read(uint8_t index);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_BUS_HPP */
@@ -0,0 +1,103 @@
+/*!
+ * \file        tle5012b_crc.cpp
+ * \name        tle5012b_crc.cpp - CRC8 engine for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_crc.hpp"
+
+uint8_t crc8Bitwise(const uint8_t *data, uint8_t length)
+{
+	uint8_t crc = CRC_SEED;
+	for (uint8_t i = 0; i < length; i++)
+	{
+		crc = crc8StepBitwise(crc, data[i]);
+	}
+	return ((~crc) & CRC_SEED);
+}
+
+uint8_t crc8Nibble(const uint8_t *data, uint8_t length)
+{
+	uint8_t crc = CRC_SEED;
+	for (uint8_t i = 0; i < length; i++)
+	{
+		crc = crc8StepNibble(crc, data[i]);
+	}
+	return ((~crc) & CRC_SEED);
+}
+
+uint8_t crc8Table(const uint8_t *data, uint8_t length)
+{
+	uint8_t crc = CRC_SEED;
+	for (uint8_t i = 0; i < length; i++)
+	{
+		crc = crc8StepTable(crc, data[i]);
+	}
+	return ((~crc) & CRC_SEED);
+}
+
+uint8_t crc8WordsBitwise(uint16_t command, const uint16_t *data, uint16_t length)
+{
+	uint8_t crc = CRC_SEED;
+	crc = crc8StepBitwise(crc8StepBitwise(crc, (uint8_t) (command >> 8)), (uint8_t) command);
+	for (uint16_t i = 0; i < length; i++)
+	{
+		crc = crc8StepBitwise(crc8StepBitwise(crc, (uint8_t) (data[i] >> 8)), (uint8_t) data[i]);
+	}
+	return ((~crc) & CRC_SEED);
+}
+
+uint8_t crc8WordsNibble(uint16_t command, const uint16_t *data, uint16_t length)
+{
+	uint8_t crc = CRC_SEED;
+	crc = crc8StepNibble(crc8StepNibble(crc, (uint8_t) (command >> 8)), (uint8_t) command);
+	for (uint16_t i = 0; i < length; i++)
+	{
+		crc = crc8StepNibble(crc8StepNibble(crc, (uint8_t) (data[i] >> 8)), (uint8_t) data[i]);
+	}
+	return ((~crc) & CRC_SEED);
+}
+
+uint8_t crc8WordsTable(uint16_t command, const uint16_t *data, uint16_t length)
+{
+	uint8_t crc = crc8StepWordTable(CRC_SEED, command);
+	for (uint16_t i = 0; i < length; i++)
+	{
+		crc = crc8StepWordTable(crc, data[i]);
+	}
+	return ((~crc) & CRC_SEED);
+}
+
+uint8_t crc8(const uint8_t *data, uint8_t length)
+{
+#if (TLE5012_CRC_IMPL == TLE5012_CRC_TABLE)
+	return (crc8Table(data, length));
+#elif (TLE5012_CRC_IMPL == TLE5012_CRC_NIBBLE)
+	return (crc8Nibble(data, length));
+#else
+	return (crc8Bitwise(data, length));
+#endif
+}
+
+uint8_t crcCalc(const uint8_t* crcData, uint8_t length)
+{
+	return (crc8(crcData, length));
+}
+
+uint8_t crc8Words(uint16_t command, const uint16_t *data, uint16_t length)
+{
+	crc8Ctx_t ctx;
+	crcInit(ctx, command);
+	for (uint16_t i = 0; i < length; i++)
+	{
+		crcUpdateWord(ctx, data[i]);
+	}
+	return (crcFinal(ctx));
+}
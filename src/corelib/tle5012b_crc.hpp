@@ -0,0 +1,214 @@
+/*!
+ * \file        tle5012b_crc.hpp
+ * \name        tle5012b_crc.hpp - CRC8 engine for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              The TLE5012B protects every SSC transfer with a CRC8 (SAE J1850, polynomial 0x1D,
+ *              seed 0xFF) in the safety word and the parameter registers 0x08 - 0x0F with the
+ *              CRC_PAR byte. This file provides three interchangeable implementations, a bit by bit
+ *              loop, a 16 entry nibble table and a 256 entry byte table with an additional
+ *              word table, which are all generated at compile time from CRC_POLYNOMIAL.
+ *              TLE5012_CRC_IMPL selects the one used by the library, see tle5012-conf-dfl.hpp.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_CRC_HPP
+#define TLE5012B_CRC_HPP
+
+#include <stdint.h>
+#include "../config/tle5012-conf.hpp"
+#include "tle5012b_util.hpp"
+#include "../pal/crc8-ctx.hpp"
+
+/**
+ * @addtogroup tle5012util
+ *
+ * @{
+ */
+
+/*!
+ * Shifts the CRC register by a number of bits with zero input,
+ * used to generate all CRC tables at compile time.
+ * @param crc actual CRC register value
+ * @param bits number of bits to shift
+ * @return CRC register after shifting
+ */
+constexpr uint8_t crc8Shift(uint8_t crc, uint8_t bits)
+{
+	return ((bits == 0) ? crc
+		: crc8Shift(((crc & 0x80) != 0) ? (uint8_t) ((crc << 1) ^ CRC_POLYNOMIAL) : (uint8_t) (crc << 1), bits - 1));
+}
+
+/*!
+ * \brief CRC table for all entries of an index sequence
+ * Entry x is the CRC register value after loading x into the upper IDXBITS
+ * bits and shifting by SHIFT bits with zero input. As the CRC is linear, the
+ * tables can be combined with XOR, e.g. a 16 bit word w is folded with
+ * crc = wordTable[crc ^ (w >> 8)] ^ byteTable[w & 0xFF] and both lookups
+ * are independent of each other.
+ */
+template<uint8_t IDXBITS, uint8_t SHIFT, typename S> struct Crc8Table;
+template<uint8_t IDXBITS, uint8_t SHIFT, uint16_t... I> struct Crc8Table<IDXBITS, SHIFT, Tle5012Seq<I...> >
+{
+	static const uint8_t table[sizeof...(I)];   //!< \brief generated table
+};
+
+template<uint8_t IDXBITS, uint8_t SHIFT, uint16_t... I>
+const uint8_t Crc8Table<IDXBITS, SHIFT, Tle5012Seq<I...> >::table[sizeof...(I)] = { crc8Shift((uint8_t) (I << (8 - IDXBITS)), SHIFT)... };
+
+typedef Crc8Table<4, 4,  Tle5012MakeSeq<16>::type>  Crc8NibbleTable;   //!< \brief 16 entry nibble table
+typedef Crc8Table<8, 8,  Tle5012MakeSeq<256>::type> Crc8ByteTable;     //!< \brief 256 entry byte table
+typedef Crc8Table<8, 16, Tle5012MakeSeq<256>::type> Crc8WordTable;     //!< \brief 256 entry table for the high byte of a word
+
+/*!
+ * Folds one byte into the CRC register, bit by bit
+ * @param crc actual CRC register value
+ * @param data byte to fold in
+ * @return new CRC register value
+ */
+inline uint8_t crc8StepBitwise(uint8_t crc, uint8_t data)
+{
+	crc ^= data;
+	for (uint8_t bit = 0; bit < 8; bit++)
+	{
+		crc = ((crc & 0x80) != 0) ? (uint8_t) ((crc << 1) ^ CRC_POLYNOMIAL) : (uint8_t) (crc << 1);
+	}
+	return (crc);
+}
+
+/*!
+ * Folds one byte into the CRC register with two nibble table lookups
+ * @param crc actual CRC register value
+ * @param data byte to fold in
+ * @return new CRC register value
+ */
+inline uint8_t crc8StepNibble(uint8_t crc, uint8_t data)
+{
+	crc ^= data;
+	crc = (uint8_t) (crc << 4) ^ Crc8NibbleTable::table[crc >> 4];
+	crc = (uint8_t) (crc << 4) ^ Crc8NibbleTable::table[crc >> 4];
+	return (crc);
+}
+
+/*!
+ * Folds one byte into the CRC register with one table lookup
+ * @param crc actual CRC register value
+ * @param data byte to fold in
+ * @return new CRC register value
+ */
+inline uint8_t crc8StepTable(uint8_t crc, uint8_t data)
+{
+	return (Crc8ByteTable::table[crc ^ data]);
+}
+
+/*!
+ * Folds one 16 bit word, high byte first, into the CRC register
+ * with two independent table lookups
+ * @param crc actual CRC register value
+ * @param data word to fold in
+ * @return new CRC register value
+ */
+inline uint8_t crc8StepWordTable(uint8_t crc, uint16_t data)
+{
+	return (Crc8WordTable::table[crc ^ (uint8_t) (data >> 8)] ^ Crc8ByteTable::table[(uint8_t) data]);
+}
+
+/*!
+ * Folds one 16 bit word, high byte first, into the CRC register
+ * with the implementation selected by TLE5012_CRC_IMPL
+ * @param crc actual CRC register value
+ * @param data word to fold in
+ * @return new CRC register value
+ */
+inline uint8_t crc8StepWord(uint8_t crc, uint16_t data)
+{
+#if (TLE5012_CRC_IMPL == TLE5012_CRC_TABLE)
+	return (crc8StepWordTable(crc, data));
+#elif (TLE5012_CRC_IMPL == TLE5012_CRC_NIBBLE)
+	return (crc8StepNibble(crc8StepNibble(crc, (uint8_t) (data >> 8)), (uint8_t) data));
+#else
+	return (crc8StepBitwise(crc8StepBitwise(crc, (uint8_t) (data >> 8)), (uint8_t) data));
+#endif
+}
+
+/*!
+ * Starts a safety word check with the command word of the transfer
+ * @param ctx CRC context to start
+ * @param command the command word of the transfer
+ */
+inline void crcInit(crc8Ctx_t &ctx, uint16_t command)
+{
+	ctx = crc8StepWord(CRC_SEED, command);
+}
+
+/*!
+ * Folds the next data word into a safety word check, so the CRC
+ * can be calculated word by word while the data is received
+ * @param ctx CRC context
+ * @param data the next received or written data word
+ */
+inline void crcUpdateWord(crc8Ctx_t &ctx, uint16_t data)
+{
+	ctx = crc8StepWord(ctx, data);
+}
+
+/*!
+ * Finishes a safety word check
+ * @param ctx CRC context
+ * @return returns 8bit CRC to compare with the safety word
+ */
+inline uint8_t crcFinal(const crc8Ctx_t &ctx)
+{
+	return ((~ctx) & CRC_SEED);
+}
+
+/*!
+ * Function for calculation the CRC of a byte array
+ * with the implementation selected by TLE5012_CRC_IMPL.
+ * @param data byte long data for CRC check
+ * @param length length of data
+ * @return returns 8bit CRC
+ */
+uint8_t crc8(const uint8_t *data, uint8_t length);
+
+/*!
+ * Function for calculation of the CRC
+ * @param crcData byte long data for CRC check
+ * @param length length of data
+ * @return runs crc8 calculation and returns CRC
+ */
+uint8_t crcCalc(const uint8_t* crcData, uint8_t length);
+
+/*!
+ * Calculates the safety word CRC directly from the command word and the
+ * data words, without splitting them into a byte array first.
+ * @param command the command word of the transfer
+ * @param data the received or written data words
+ * @param length number of data words
+ * @return returns 8bit CRC
+ */
+uint8_t crc8Words(uint16_t command, const uint16_t *data, uint16_t length);
+
+/*!
+ * The same CRC calculations with a fixed implementation, independent
+ * of TLE5012_CRC_IMPL, e.g. for comparing them in a benchmark.
+ * Unused variants and their tables are removed by the linker.
+ */
+uint8_t crc8Bitwise(const uint8_t *data, uint8_t length);
+uint8_t crc8Nibble(const uint8_t *data, uint8_t length);
+uint8_t crc8Table(const uint8_t *data, uint8_t length);
+uint8_t crc8WordsBitwise(uint16_t command, const uint16_t *data, uint16_t length);
+uint8_t crc8WordsNibble(uint16_t command, const uint16_t *data, uint16_t length);
+uint8_t crc8WordsTable(uint16_t command, const uint16_t *data, uint16_t length);
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_CRC_HPP */
@@ -0,0 +1,183 @@
+/*!
+ * \file        tle5012b_estimator.cpp
+ * \name        tle5012b_estimator.cpp - speed estimator for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012estimator
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_estimator.hpp"
+
+Tle5012Estimator::Tle5012Estimator()
+{
+	mode = ESTIMATOR_TRACK;
+	shift = TLE5012_ESTIMATOR_BANDWIDTH;
+	setUpdateRate(1);
+	reset();
+}
+
+errorTypes Tle5012Estimator::begin(Tle5012b &sensor)
+{
+	uint16_t mod1 = 0;
+	errorTypes status = sensor.readIntMode1(mod1);
+	if (status == NO_ERROR)
+	{
+		setUpdateRate((uint8_t) (mod1 >> 14));
+	}
+	reset();
+	return (status);
+}
+
+void Tle5012Estimator::setUpdateRate(uint8_t firMD)
+{
+	static const uint32_t firMDTime[4] = { 21300, 42700, 85300, 170600 };
+	setFrameTime(firMDTime[firMD & 0x3]);
+}
+
+void Tle5012Estimator::setFrameTime(uint32_t frameTime)
+{
+	// shorter periods would divide by zero or overflow accelScale
+	this->frameTime = (frameTime < ESTIMATOR_MIN_FRAME_TIME) ? ESTIMATOR_MIN_FRAME_TIME : frameTime;
+	frameTime = this->frameTime;
+	// cdeg/s = speed * 36000 / 2^32 / T and °/s² = accel / 2^8 * 360 / 2^32 / T²
+	speedScale = 36000000000000ULL / frameTime;
+	accelScale = ((((360000000000ULL << 16) / frameTime) / frameTime) * 1000000000ULL) >> 32;
+}
+
+uint32_t Tle5012Estimator::getFrameTime()
+{
+	return (frameTime);
+}
+
+void Tle5012Estimator::setMode(estimatorMode mode)
+{
+	this->mode = mode;
+	reset();
+}
+
+void Tle5012Estimator::setBandwidth(uint8_t shift)
+{
+	this->shift = (shift < 2) ? 2 : ((shift > 8) ? 8 : shift);
+}
+
+void Tle5012Estimator::reset()
+{
+	angle = 0;
+	speed = 0;
+	accel = 0;
+	lastFrame = 0;
+	updates = 0;
+	stale = 0;
+	valid = false;
+}
+
+errorTypes Tle5012Estimator::readAngle(Tle5012b &sensor, int16_t &rawAngle, uint8_t &frameCounter, updTypes upd)
+{
+	uint16_t rawData[ESTIMATOR_NUM_REGISTERS + 1];
+	errorTypes status = sensor.readBurst(sensor.reg.REG_AVAL + ESTIMATOR_NUM_REGISTERS, rawData, ESTIMATOR_NUM_REGISTERS + 1, upd);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+
+	// AVAL is a 15 bit signed value, FCNT the bits 14:9 of AREV
+	rawData[0] &= DELETE_BIT_15;
+	if (rawData[0] & CHECK_BIT_14)
+	{
+		rawData[0] -= CHANGE_UINT_TO_INT_15;
+	}
+	rawAngle = (int16_t) rawData[0];
+	frameCounter = (uint8_t) ((rawData[2] & GET_BIT_14_9) >> 9);
+	return (status);
+}
+
+errorTypes Tle5012Estimator::update(Tle5012b &sensor, updTypes upd)
+{
+	int16_t rawAngle = 0;
+	uint8_t frameCounter = 0;
+	errorTypes status = readAngle(sensor, rawAngle, frameCounter, upd);
+	if (status == NO_ERROR)
+	{
+		update(rawAngle, frameCounter);
+	}
+	return (status);
+}
+
+void Tle5012Estimator::update(int16_t rawAngle, uint8_t frameCounter)
+{
+	update(rawAngle, frameCounter, (frameCounter - lastFrame) & 0x3F);
+}
+
+void Tle5012Estimator::update(int16_t rawAngle, uint8_t frameCounter, uint32_t frames)
+{
+	uint32_t measured = (uint32_t) (int32_t) rawAngle << ESTIMATOR_ANGLE_SHIFT;
+	if (!valid)
+	{
+		angle = measured;
+		lastFrame = frameCounter;
+		valid = true;
+		return;
+	}
+
+	if (frames == 0)
+	{
+		stale++;
+		return;
+	}
+	lastFrame = frameCounter;
+	updates++;
+
+	if (mode == ESTIMATOR_DIFF)
+	{
+		int32_t step = (int32_t) (measured - angle);
+		int32_t newSpeed = step / (int32_t) frames;
+		accel = (updates > 1) ? (int32_t) ((((int64_t) newSpeed - speed) * (1 << ESTIMATOR_ACCEL_BITS)) / frames) : 0;
+		speed = newSpeed;
+		angle = measured;
+		return;
+	}
+
+	// predict over the frames, then correct with gains 3 * 2^-n, 3 * 2^-2n and 2^-3n
+	int64_t n = frames;
+	uint32_t predicted = angle + (uint32_t) (((int64_t) speed * n) + (((int64_t) accel * n * n) >> (ESTIMATOR_ACCEL_BITS + 1)));
+	int64_t predictedSpeed = speed + (((int64_t) accel * n) >> ESTIMATOR_ACCEL_BITS);
+	int64_t error = (int32_t) (measured - predicted);
+	angle = predicted + (uint32_t) ((3 * error) >> shift);
+	speed = (int32_t) (predictedSpeed + (((3 * error) >> (2 * shift)) / n));
+	accel = (int32_t) (accel + (((error * (1 << ESTIMATOR_ACCEL_BITS)) >> (3 * shift)) / (n * n)));
+}
+
+uint8_t Tle5012Estimator::frameCounter()
+{
+	return (lastFrame);
+}
+
+int32_t Tle5012Estimator::angleQ16()
+{
+	return ((int16_t) (angle >> 16));
+}
+
+int32_t Tle5012Estimator::speedCdeg()
+{
+	return ((int32_t) ((((int64_t) speed * (int64_t) speedScale) + (1LL << 31)) >> 32));
+}
+
+int32_t Tle5012Estimator::accelDeg()
+{
+	return ((int32_t) ((((int64_t) accel * (int64_t) accelScale) + (1LL << 23)) >> 24));
+}
+
+int32_t Tle5012Estimator::predictQ16(int32_t latencyMicro)
+{
+	// latency in Q16 update periods, limited to the 64 periods of FCNT
+	int64_t frames = ((int64_t) latencyMicro * 1000 * 65536) / frameTime;
+	frames = (frames > (64LL << 16)) ? (64LL << 16) : ((frames < -(64LL << 16)) ? -(64LL << 16) : frames);
+	int64_t step = (((int64_t) speed * frames) >> 16)
+		+ (((((int64_t) accel * frames) >> 16) * frames) >> (16 + ESTIMATOR_ACCEL_BITS + 1));
+	return ((int16_t) ((angle + (uint32_t) step) >> 16));
+}
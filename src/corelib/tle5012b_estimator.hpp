@@ -0,0 +1,194 @@
+/*!
+ * \file        tle5012b_estimator.hpp
+ * \name        tle5012b_estimator.hpp - speed estimator for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              Estimates the angle speed and acceleration from consecutive AVAL values and the
+ *              6 bit frame counter FCNT of AREV instead of ASPD. FCNT counts the update periods
+ *              of the sensor, so the time between two values is exact and independent of the
+ *              read jitter of the host. The difference mode divides the angle step by the frames,
+ *              the tracking mode runs a third order angle observer like a PLL, which follows the
+ *              angle with a bandwidth of 2^-n per update period and filters the quantization
+ *              noise at low speed. Both report the speed, the acceleration and the angle predicted
+ *              for a latency. Everything is integer arithmetic, one update in the tracking mode
+ *              takes a few 64 bit multiplications and shifts.
+ *
+ *              The angle is kept with 2^32 per turn, so it wraps like the sensor value.
+ *              AVAL must use the default 360° angle range and the reads must be less than
+ *              64 update periods apart, else FCNT wraps unnoticed.
+ * \ref         tle5012estimator
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_ESTIMATOR_HPP
+#define TLE5012B_ESTIMATOR_HPP
+
+#include <stdint.h>
+#include "TLE5012b.hpp"
+
+/**
+ * @addtogroup tle5012estimator
+ *
+ * @{
+ */
+
+#define ESTIMATOR_ANGLE_SHIFT    17         //!< \brief raw angle in 1/32768 turns to 2^32 per turn
+#define ESTIMATOR_ACCEL_BITS     8          //!< \brief fractional bits of the acceleration
+#define ESTIMATOR_NUM_REGISTERS  3          //!< \brief AVAL, ASPD and AREV in one burst
+#define ESTIMATOR_MIN_FRAME_TIME 21300      //!< \brief shortest update period in ns, FIR_MD 0
+
+/*!
+ * Speed and acceleration from the angle values and the frame counter
+ */
+class Tle5012Estimator
+{
+	public:
+
+		//!< \brief estimation methods
+		enum estimatorMode
+		{
+			ESTIMATOR_DIFF = 0,      //!< \brief angle step divided by the frames
+			ESTIMATOR_TRACK          //!< \brief third order tracking loop
+		};
+
+		uint32_t updates;            //!< \brief updates with at least one new frame
+		uint32_t stale;              //!< \brief updates without a new frame
+
+		Tle5012Estimator();
+
+		/*!
+		* Reads FIR_MD from MOD_1 to set the update period
+		* @param [in,out] sensor sensor to read
+		* @return CRC error type
+		*/
+		errorTypes begin(Tle5012b &sensor);
+
+		/*!
+		* Sets the update period of the sensor
+		* @param [in] firMD FIR_MD bits 15:14 of MOD_1, 0 to 3 for 21.3 to 170.6 us
+		*/
+		void setUpdateRate(uint8_t firMD);
+
+		/*!
+		* Sets the update period of the sensor, e.g. measured against the host clock
+		* @param [in] frameTime update period in ns, shorter ones than ESTIMATOR_MIN_FRAME_TIME are clamped
+		*/
+		void setFrameTime(uint32_t frameTime);
+
+		/*!
+		* Returns the update period of the sensor
+		* @return update period in ns
+		*/
+		uint32_t getFrameTime();
+
+		/*!
+		* Sets the method
+		* @param [in] mode ESTIMATOR_DIFF or ESTIMATOR_TRACK
+		*/
+		void setMode(estimatorMode mode);
+
+		/*!
+		* Sets the bandwidth of the tracking loop to 2^-shift per update period,
+		* the loop settles in about 8 * 2^shift update periods
+		* @param [in] shift 2 to 8, larger values filter more
+		*/
+		void setBandwidth(uint8_t shift);
+
+		/*!
+		* Forgets the state, the next update starts at its angle with speed 0
+		*/
+		void reset();
+
+		/*!
+		* Reads AVAL, ASPD and AREV in one burst of 5 words and updates the estimation.
+		* Directly read, a new update period may start between AVAL and AREV, which
+		* gives one frame too many now and one too few on the next update.
+		* @param [in,out] sensor sensor to read
+		* @param [in] upd read from the update buffer, use UPD_high together with SPIC::triggerUpdate
+		* @return CRC error type
+		*/
+		errorTypes update(Tle5012b &sensor, updTypes upd=UPD_low);
+
+		/*!
+		* Updates the estimation with an angle value read by the caller
+		* @param [in] rawAngle AVAL 15 bit signed angle
+		* @param [in] frameCounter AREV bits 14:9 of the same update period
+		*/
+		void update(int16_t rawAngle, uint8_t frameCounter);
+
+		/*!
+		* Same as above, with the update periods since the last update known by the
+		* caller, e.g. from a clock when the reads may be 64 or more periods apart
+		* @param [in] rawAngle AVAL 15 bit signed angle
+		* @param [in] frameCounter AREV bits 14:9 of the same update period
+		* @param [in] frames update periods since the last update, 0 for a stale value
+		*/
+		void update(int16_t rawAngle, uint8_t frameCounter, uint32_t frames);
+
+		/*!
+		* Reads AVAL and FCNT in one burst of AVAL, ASPD and AREV
+		* @param [in,out] sensor sensor to read
+		* @param [out] rawAngle AVAL 15 bit signed angle
+		* @param [out] frameCounter AREV bits 14:9
+		* @param [in] upd read from the update buffer, use UPD_high together with SPIC::triggerUpdate
+		* @return CRC error type
+		*/
+		static errorTypes readAngle(Tle5012b &sensor, int16_t &rawAngle, uint8_t &frameCounter, updTypes upd=UPD_low);
+
+		/*!
+		* Frame counter of the last update
+		* @return FCNT bits 14:9 of AREV
+		*/
+		uint8_t frameCounter();
+
+		/*!
+		* Estimated angle of the last update period
+		* @return angle in Q16 turns, 65536 is one turn
+		*/
+		int32_t angleQ16();
+
+		/*!
+		* Estimated angle speed
+		* @return speed in 1/100 °/s
+		*/
+		int32_t speedCdeg();
+
+		/*!
+		* Estimated angle acceleration
+		* @return acceleration in °/s²
+		*/
+		int32_t accelDeg();
+
+		/*!
+		* Angle extrapolated with the speed and the acceleration. The angle value is
+		* calculated at the start of an update period, so the latency is the time from
+		* there, e.g. the read latency plus half an update period.
+		* @param [in] latencyMicro time after the last update period in us, up to +-64 periods
+		* @return angle in Q16 turns, 65536 is one turn
+		*/
+		int32_t predictQ16(int32_t latencyMicro);
+
+	private:
+
+		uint32_t      angle;         //!< \brief angle with 2^32 per turn
+		int32_t       speed;         //!< \brief angle step per update period
+		int32_t       accel;         //!< \brief speed step per update period with ESTIMATOR_ACCEL_BITS
+		uint32_t      frameTime;     //!< \brief update period in ns
+		uint64_t      speedScale;    //!< \brief cdeg/s per 2^32 speed
+		uint64_t      accelScale;    //!< \brief °/s² per 2^24 accel
+		estimatorMode mode;
+		uint8_t       shift;         //!< \brief tracking loop bandwidth
+		uint8_t       lastFrame;     //!< \brief FCNT of the last update
+		bool          valid;
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_ESTIMATOR_HPP */
@@ -0,0 +1,74 @@
+/*!
+ * \file        tle5012b_foc.cpp
+ * \name        tle5012b_foc.cpp - electrical angle and sin/cos for FOC with the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012foc
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_foc.hpp"
+
+Tle5012Foc::Tle5012Foc()
+{
+	electrical = 0;
+	sinQ15 = 0;
+	cosQ15 = FOC_Q15_ONE;
+	zero = 0;
+	polePairs = 1;
+	reverse = false;
+}
+
+void Tle5012Foc::setPolePairs(uint8_t polePairs)
+{
+	this->polePairs = (polePairs == 0) ? 1 : polePairs;
+}
+
+void Tle5012Foc::setZero(uint16_t zeroQ16)
+{
+	zero = zeroQ16;
+}
+
+void Tle5012Foc::alignZero(int32_t angleQ16)
+{
+	zero = 0;
+	zero = electricalQ16(angleQ16);
+}
+
+void Tle5012Foc::setDirection(bool reverse)
+{
+	this->reverse = reverse;
+}
+
+uint16_t Tle5012Foc::electricalQ16(int32_t angleQ16)
+{
+	// all in 16 bit, so the turns fall off for free
+	uint16_t mechanical = (uint16_t) (reverse ? -angleQ16 : angleQ16);
+	return ((uint16_t) ((uint16_t) (mechanical * polePairs) - zero));
+}
+
+void Tle5012Foc::update(int32_t angleQ16)
+{
+	electrical = electricalQ16(angleQ16);
+	sinCosQ15(electrical, sinQ15, cosQ15);
+}
+
+errorTypes Tle5012Foc::update(Tle5012b &sensor, updTypes upd)
+{
+	int32_t angleQ16 = 0;
+	errorTypes status = sensor.getAngleQ16(angleQ16, upd);
+	if (status == NO_ERROR)
+	{
+		update(angleQ16);
+	}
+	return (status);
+}
+
+void Tle5012Foc::sinCosQ15(uint16_t angleQ16, int16_t &sinQ15, int16_t &cosQ15)
+{
+	focSinCosQ15<TLE5012_SINCOS_BITS>(angleQ16, sinQ15, cosQ15);
+}
@@ -0,0 +1,195 @@
+/*!
+ * \file        tle5012b_foc.hpp
+ * \name        tle5012b_foc.hpp - electrical angle and sin/cos for FOC with the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              Output stage for field oriented motor control on the 15 bit angle value. The
+ *              mechanical angle is turned into the electrical angle with the pole pairs, the
+ *              direction and the electrical zero in 16 bit integer arithmetic, where one turn is
+ *              65536 and wraps for free. Sine and cosine in Q15 come from a quarter wave table
+ *              with linear interpolation, which is generated at compile time with
+ *              2^TLE5012_SINCOS_BITS segments, see tle5012-conf-dfl.hpp. There is no floating
+ *              point arithmetic and no division, so it also suits FPU-less Cortex-M0 targets.
+ * \ref         tle5012foc
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_FOC_HPP
+#define TLE5012B_FOC_HPP
+
+#include <stdint.h>
+#include "TLE5012b.hpp"
+
+/**
+ * @addtogroup tle5012foc
+ *
+ * @{
+ */
+
+#define FOC_QUARTER_BITS    14          //!< \brief bits of a quarter turn of a Q16 angle
+#define FOC_Q15_ONE         32767       //!< \brief largest Q15 value
+
+/*!
+ * sin(x) for 0 <= x <= pi/2 as Taylor series up to x^15, which is exact to
+ * about 1e-12, used to generate the tables at compile time
+ * @param x angle in radian
+ * @return sin(x)
+ */
+constexpr double focSinTaylor(double x)
+{
+	return (x * (1.0 - x * x / 6.0 * (1.0 - x * x / 20.0 * (1.0 - x * x / 42.0 * (1.0 - x * x / 72.0
+		* (1.0 - x * x / 110.0 * (1.0 - x * x / 156.0 * (1.0 - x * x / 210.0))))))));
+}
+
+/*!
+ * \brief Quarter wave sine table in Q15 with 2^BITS segments and 2^BITS + 1 entries
+ */
+template<uint8_t BITS, typename S> struct FocSinTable;
+template<uint8_t BITS, uint16_t... I> struct FocSinTable<BITS, Tle5012Seq<I...> >
+{
+	static const int16_t table[sizeof...(I)];   //!< \brief generated table
+};
+
+template<uint8_t BITS, uint16_t... I>
+const int16_t FocSinTable<BITS, Tle5012Seq<I...> >::table[sizeof...(I)] = {
+	(int16_t) (focSinTaylor(I * (1.5707963267948966 / (1 << BITS))) * FOC_Q15_ONE + 0.5)... };
+
+/*!
+ * Sine of a quarter turn angle from the table with linear interpolation
+ * @param x angle in Q16 turns, 0 to 16384
+ * @return sine in Q15
+ */
+template<uint8_t BITS>
+inline int16_t focQuarterSin(uint16_t x)
+{
+	static_assert((BITS >= 1) && (BITS <= FOC_QUARTER_BITS - 1), "sine table bits must be 1 to 13");
+	const int16_t *table = FocSinTable<BITS, typename Tle5012MakeSeq<(1 << BITS) + 1>::type>::table;
+	const uint8_t shift = FOC_QUARTER_BITS - BITS;
+	uint16_t index = x >> shift;
+	int32_t fraction = x & ((1 << shift) - 1);
+	if (fraction == 0)
+	{
+		return (table[index]);
+	}
+	return ((int16_t) (table[index] + ((((int32_t) table[index + 1] - table[index]) * fraction + (1 << (shift - 1))) >> shift)));
+}
+
+/*!
+ * Sine and cosine from the quarter wave table
+ * @param [in] angleQ16 angle in Q16 turns, 65536 is one turn
+ * @param [out] sinQ15 sine in Q15
+ * @param [out] cosQ15 cosine in Q15
+ */
+template<uint8_t BITS>
+inline void focSinCosQ15(uint16_t angleQ16, int16_t &sinQ15, int16_t &cosQ15)
+{
+	const uint16_t quarter = 1U << FOC_QUARTER_BITS;
+	uint16_t x = angleQ16 & (quarter - 1);
+	int16_t s = focQuarterSin<BITS>(x);
+	int16_t c = focQuarterSin<BITS>(quarter - x);
+	switch (angleQ16 >> FOC_QUARTER_BITS)
+	{
+		case 0:
+			sinQ15 = s;
+			cosQ15 = c;
+			break;
+		case 1:
+			sinQ15 = c;
+			cosQ15 = -s;
+			break;
+		case 2:
+			sinQ15 = -s;
+			cosQ15 = -c;
+			break;
+		default:
+			sinQ15 = -c;
+			cosQ15 = s;
+			break;
+	}
+}
+
+/*!
+ * Electrical angle and sin/cos of a motor from the mechanical angle
+ */
+class Tle5012Foc
+{
+	public:
+
+		uint16_t electrical;         //!< \brief electrical angle of the last update in Q16 turns
+		int16_t  sinQ15;             //!< \brief sine of the electrical angle in Q15
+		int16_t  cosQ15;             //!< \brief cosine of the electrical angle in Q15
+
+		Tle5012Foc();
+
+		/*!
+		* Sets the pole pairs of the motor
+		* @param [in] polePairs electrical turns per mechanical turn, at least 1
+		*/
+		void setPolePairs(uint8_t polePairs);
+
+		/*!
+		* Sets the electrical zero
+		* @param [in] zeroQ16 electrical angle in Q16 turns which becomes 0
+		*/
+		void setZero(uint16_t zeroQ16);
+
+		/*!
+		* Sets the electrical zero to the actual angle, e.g. with the rotor
+		* aligned to the d axis by a current into phase U
+		* @param [in] angleQ16 mechanical angle in Q16 turns at the electrical zero
+		*/
+		void alignZero(int32_t angleQ16);
+
+		/*!
+		* Sets the direction
+		* @param [in] reverse true if the electrical angle runs against the sensor angle
+		*/
+		void setDirection(bool reverse);
+
+		/*!
+		* Electrical angle
+		* @param [in] angleQ16 mechanical angle in Q16 turns, e.g. from getAngleQ16
+		* or Tle5012Predictor::angleAtQ16
+		* @return electrical angle in Q16 turns, 65536 is one turn
+		*/
+		uint16_t electricalQ16(int32_t angleQ16);
+
+		/*!
+		* Sets electrical, sinQ15 and cosQ15 from a mechanical angle
+		* @param [in] angleQ16 mechanical angle in Q16 turns
+		*/
+		void update(int32_t angleQ16);
+
+		/*!
+		* Reads AVAL and sets electrical, sinQ15 and cosQ15
+		* @param [in,out] sensor sensor to read
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @return CRC error type
+		*/
+		errorTypes update(Tle5012b &sensor, updTypes upd=UPD_low);
+
+		/*!
+		* Sine and cosine with the TLE5012_SINCOS_BITS table
+		* @param [in] angleQ16 angle in Q16 turns, 65536 is one turn
+		* @param [out] sinQ15 sine in Q15
+		* @param [out] cosQ15 cosine in Q15
+		*/
+		static void sinCosQ15(uint16_t angleQ16, int16_t &sinQ15, int16_t &cosQ15);
+
+	private:
+
+		uint16_t zero;               //!< \brief electrical zero in Q16 turns
+		uint8_t  polePairs;
+		bool     reverse;
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_FOC_HPP */
@@ -0,0 +1,144 @@
+/*!
+ * \file        tle5012b_position.cpp
+ * \name        tle5012b_position.cpp - multi-turn position for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012position
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_position.hpp"
+
+Tle5012Position::Tle5012Position()
+{
+	gearNumerator = 1;
+	gearDenominator = 1;
+	maxStep = 0;
+	offset = 0;
+	reset();
+}
+
+void Tle5012Position::reset()
+{
+	raw = 0;
+	lastAbsolute = 0;
+	lastFrame = 0;
+	rejectsInRow = 0;
+	rejected = 0;
+	resyncs = 0;
+	valid = false;
+}
+
+void Tle5012Position::setMaxStep(uint16_t lsbPerFrame)
+{
+	maxStep = lsbPerFrame;
+}
+
+void Tle5012Position::setGearRatio(int32_t numerator, int32_t denominator)
+{
+	if (denominator != 0)
+	{
+		gearNumerator = numerator;
+		gearDenominator = denominator;
+	}
+}
+
+void Tle5012Position::setZero()
+{
+	offset = raw;
+}
+
+void Tle5012Position::setZero(int64_t offset)
+{
+	this->offset = offset;
+}
+
+errorTypes Tle5012Position::update(Tle5012b &sensor, updTypes upd)
+{
+	Tle5012b::motionSnapshot snapshot;
+	errorTypes status = sensor.readMotionSnapshot(snapshot, upd);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	return (update(snapshot));
+}
+
+errorTypes Tle5012Position::update(const Tle5012b::motionSnapshot &snapshot)
+{
+	// FCNT runs with 6 bit, so 0 frames may also be 64
+	return (update(snapshot, (snapshot.frameCounter - lastFrame) & 0x3F));
+}
+
+errorTypes Tle5012Position::update(const Tle5012b::motionSnapshot &snapshot, uint32_t frames)
+{
+	// AREV counts the turns at the +-180° wrap of the signed AVAL
+	int32_t absolute = ((int32_t) snapshot.revolutions * (1L << POSITION_TURN_BITS)) + snapshot.rawAngle;
+	if (!valid)
+	{
+		raw = absolute;
+		lastAbsolute = absolute;
+		lastFrame = snapshot.frameCounter;
+		valid = true;
+		return (NO_ERROR);
+	}
+
+	// shortest way within the 24 bit window, so the 9 bit counter may wrap
+	const int32_t window = 1L << POSITION_WINDOW_BITS;
+	int32_t delta = (absolute - lastAbsolute) & (window - 1);
+	if (delta >= (window / 2))
+	{
+		delta -= window;
+	}
+
+	if (maxStep != 0)
+	{
+		// allow at least one frame, the limit may exceed 32 bit for long gaps
+		int64_t limit = (int64_t) maxStep * ((frames > 0) ? frames : 1);
+		int32_t distance = (delta < 0) ? -delta : delta;
+		if ((distance > limit) && (rejectsInRow < POSITION_MAX_REJECTS - 1))
+		{
+			rejectsInRow++;
+			rejected++;
+			return (ANGLE_SPEED_ERROR);
+		}
+		if (distance > limit)
+		{
+			resyncs++;
+		}
+	}
+	rejectsInRow = 0;
+	raw += delta;
+	lastAbsolute = absolute;
+	lastFrame = snapshot.frameCounter;
+	return (NO_ERROR);
+}
+
+int64_t Tle5012Position::position()
+{
+	return (raw - offset);
+}
+
+int64_t Tle5012Position::scaled()
+{
+	// split the division, so only the result itself can overflow
+	int64_t pos = raw - offset;
+	int64_t quotient = pos / gearDenominator;
+	int64_t remainder = pos % gearDenominator;
+	return ((quotient * gearNumerator) + ((remainder * gearNumerator) / gearDenominator));
+}
+
+int64_t Tle5012Position::turns()
+{
+	int64_t pos = raw - offset;
+	return ((pos >= 0) ? (pos >> POSITION_TURN_BITS) : -((-pos + (1L << POSITION_TURN_BITS) - 1) >> POSITION_TURN_BITS));
+}
+
+bool Tle5012Position::isValid()
+{
+	return (valid);
+}
@@ -0,0 +1,147 @@
+/*!
+ * \file        tle5012b_position.hpp
+ * \name        tle5012b_position.hpp - multi-turn position for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              Merges the 15 bit angle value AVAL and the 9 bit revolution counter of AREV into
+ *              one 64 bit position in angle LSBs, 32768 per turn, which keeps counting when the
+ *              revolution counter wraps at +-256 turns. Position changes which are larger than
+ *              the magnet can move in the frames counted by FCNT, or given by the caller, since
+ *              the last update are rejected as glitches, e.g. a burst read which got AVAL and
+ *              AREV from different update periods. A zero offset and a gear ratio give the
+ *              position of the axis. Every update is integer only.
+ * \ref         tle5012position
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_POSITION_HPP
+#define TLE5012B_POSITION_HPP
+
+#include <stdint.h>
+#include "TLE5012b.hpp"
+
+/**
+ * @addtogroup tle5012position
+ *
+ * @{
+ */
+
+#define POSITION_TURN_BITS       15         //!< \brief angle LSBs per turn as power of two
+#define POSITION_WINDOW_BITS     24         //!< \brief 9 bit revolutions and 15 bit angle
+#define POSITION_MAX_REJECTS     3          //!< \brief rejected updates in a row until the new position is taken
+
+/*!
+ * Multi-turn position from AVAL and AREV
+ */
+class Tle5012Position
+{
+	public:
+
+		uint32_t rejected;           //!< \brief updates rejected as implausible jumps
+		uint32_t resyncs;            //!< \brief jumps taken after POSITION_MAX_REJECTS rejects in a row
+
+		Tle5012Position();
+
+		/*!
+		* Forgets the position, the next update starts at the absolute sensor position
+		* within +-256 turns. Keeps the zero offset and the gear ratio.
+		*/
+		void reset();
+
+		/*!
+		* Sets the largest plausible position change per update period. The frames
+		* since the last update come from the 6 bit FCNT, so reads 64 or more
+		* periods apart need the update with the frames known by the caller.
+		* @param [in] lsbPerFrame angle LSBs per FIR_MD update period, 0 switches the check off
+		*/
+		void setMaxStep(uint16_t lsbPerFrame);
+
+		/*!
+		* Sets the gear ratio of scaled()
+		* @param [in] numerator axis units per denominator LSBs
+		* @param [in] denominator LSBs per numerator axis units, 0 is ignored
+		*/
+		void setGearRatio(int32_t numerator, int32_t denominator);
+
+		/*!
+		* Sets the zero of position() and scaled() to the actual position
+		*/
+		void setZero();
+
+		/*!
+		* Sets the zero of position() and scaled()
+		* @param [in] offset raw position in LSBs which becomes 0
+		*/
+		void setZero(int64_t offset);
+
+		/*!
+		* Reads AVAL, ASPD, AREV and FSYNC in one burst and updates the position
+		* @param [in,out] sensor sensor to read
+		* @param [in] upd read from the update buffer, use UPD_high together with SPIC::triggerUpdate
+		* @return the read error, or ANGLE_SPEED_ERROR for a rejected jump
+		*/
+		errorTypes update(Tle5012b &sensor, updTypes upd=UPD_low);
+
+		/*!
+		* Updates the position from a snapshot read by the caller
+		* @param [in] snapshot motion snapshot with rawAngle, revolutions and frameCounter
+		* @return NO_ERROR, or ANGLE_SPEED_ERROR for a rejected jump
+		*/
+		errorTypes update(const Tle5012b::motionSnapshot &snapshot);
+
+		/*!
+		* Same as above, with the update periods since the last update known by the
+		* caller, e.g. from a clock when the reads may be 64 or more periods apart
+		* @param [in] snapshot motion snapshot with rawAngle, revolutions and frameCounter
+		* @param [in] frames update periods since the last update, 0 is taken as one
+		* @return NO_ERROR, or ANGLE_SPEED_ERROR for a rejected jump
+		*/
+		errorTypes update(const Tle5012b::motionSnapshot &snapshot, uint32_t frames);
+
+		/*!
+		* Position in angle LSBs from the zero, 32768 per turn
+		* @return position
+		*/
+		int64_t position();
+
+		/*!
+		* Position from the zero times the gear ratio, rounded toward zero
+		* @return position in axis units
+		*/
+		int64_t scaled();
+
+		/*!
+		* Full turns from the zero, rounded toward minus infinity
+		* @return turns
+		*/
+		int64_t turns();
+
+		/*!
+		* Tells if the position was set by an update
+		* @return true after the first update
+		*/
+		bool isValid();
+
+	private:
+
+		int64_t  raw;                //!< \brief position in LSBs since the first update
+		int64_t  offset;             //!< \brief zero of position()
+		int32_t  lastAbsolute;       //!< \brief last 24 bit absolute sensor position
+		int32_t  gearNumerator;
+		int32_t  gearDenominator;
+		uint16_t maxStep;            //!< \brief LSBs per frame, 0 for no check
+		uint8_t  lastFrame;          //!< \brief FCNT of the last update
+		uint8_t  rejectsInRow;
+		bool     valid;
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_POSITION_HPP */
@@ -0,0 +1,194 @@
+/*!
+ * \file        tle5012b_predictor.cpp
+ * \name        tle5012b_predictor.cpp - latency compensated angle for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012predictor
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_predictor.hpp"
+
+Tle5012Predictor::Tle5012Predictor(Tle5012b &sensor, Timer &timer)
+{
+	this->sensor = &sensor;
+	this->timer = &timer;
+	frameTime = estimator.getFrameTime();
+	readMicro = 0;
+	prediction = false;
+	lastTime = 0;
+	timeNs = 0;
+	frameStart = 0;
+	earliest = 0;
+	latest = 0;
+	lastFrame = 0;
+}
+
+errorTypes Tle5012Predictor::begin()
+{
+	uint16_t mod2 = 0;
+	errorTypes status = sensor->readIntMode2(mod2);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	prediction = (mod2 & 0x0004) != 0;
+	status = estimator.begin(*sensor);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	frameTime = estimator.getFrameTime();
+
+	timer->start();
+	timer->elapsedMicro(lastTime);
+	timeNs = 0;
+	return (calibrate());
+}
+
+int64_t Tle5012Predictor::now()
+{
+	uint32_t time = 0;
+	timer->elapsedMicro(time);
+	timeNs += (int64_t) (uint32_t) (time - lastTime) * 1000;
+	lastTime = time;
+	return (timeNs);
+}
+
+errorTypes Tle5012Predictor::readFrame(uint8_t &frame, int64_t &time)
+{
+	uint16_t rawData = 0;
+	time = now();
+	errorTypes status = sensor->readFromSensor(sensor->reg.REG_AREV, rawData);
+	frame = (uint8_t) ((rawData & GET_BIT_14_9) >> 9);
+	return (status);
+}
+
+errorTypes Tle5012Predictor::calibrate(uint16_t frames)
+{
+	errorTypes status = NO_ERROR;
+	uint32_t nominal = estimator.getFrameTime();
+
+	// time of update()
+	int64_t start = now();
+	for (uint8_t i = 0; (i < PREDICTOR_READ_ROUNDS) && (status == NO_ERROR); i++)
+	{
+		status = update();
+	}
+	readMicro = (uint32_t) ((now() - start + (PREDICTOR_READ_ROUNDS * 500)) / (PREDICTOR_READ_ROUNDS * 1000));
+
+	// the update period from the frame counter changes, each between two reads
+	int64_t deadline = now() + (((int64_t) frames + 2) * nominal * 2);
+	int64_t time = 0;
+	int64_t previous = 0;
+	int64_t firstEdge = -1;
+	uint8_t frame = 0;
+	uint8_t last = 0;
+	uint32_t counted = 0;
+	status = (status == NO_ERROR) ? readFrame(last, previous) : status;
+	while (status == NO_ERROR)
+	{
+		status = readFrame(frame, time);
+		if ((status != NO_ERROR) || (time > deadline))
+		{
+			status = (status == NO_ERROR) ? SYSTEM_ERROR : status;
+			break;
+		}
+		uint8_t steps = (frame - last) & 0x3F;
+		int64_t edge = (previous + time) / 2;
+		last = frame;
+		previous = time;
+		if (steps == 0)
+		{
+			continue;
+		}
+		if (firstEdge < 0)
+		{
+			firstEdge = edge;
+			continue;
+		}
+		counted += steps;
+		if (counted >= frames)
+		{
+			uint32_t measured = (uint32_t) ((edge - firstEdge) / counted);
+			uint32_t tolerance = (nominal / 100) * PREDICTOR_TOLERANCE;
+			if ((measured < nominal - tolerance) || (measured > nominal + tolerance))
+			{
+				status = SYSTEM_ERROR;
+				break;
+			}
+			frameTime = measured;
+			estimator.setFrameTime(frameTime);
+			estimator.reset();
+			frameStart = edge;
+			earliest = edge - (frameTime / 2);
+			latest = edge + (frameTime / 2);
+			lastFrame = frame;
+			break;
+		}
+	}
+	return (status);
+}
+
+errorTypes Tle5012Predictor::update()
+{
+	// the update trigger latches AVAL and AREV at the start of the read
+	int16_t rawAngle = 0;
+	uint8_t frame = 0;
+	int64_t latch = now();
+	sensor->sBus->triggerUpdate();
+	errorTypes status = Tle5012Estimator::readAngle(*sensor, rawAngle, frame, UPD_high);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+
+	// FCNT counts the update periods, the time since the last one resolves its 6 bit wrap
+	int64_t steps = (frame - lastFrame) & 0x3F;
+	int64_t expected = (latch - frameStart) / frameTime;
+	steps += ((expected - steps + 32) / 64) * 64;
+	steps = (steps < 0) ? 0 : steps;
+	estimator.update(rawAngle, frame, (uint32_t) steps);
+	lastFrame = frame;
+
+	// the period started before the latch and the next one after it, the bounds
+	// widen with the uncertainty of the measured period
+	int64_t drift = (steps * frameTime) >> PREDICTOR_DRIFT_SHIFT;
+	earliest += (steps * frameTime) - drift;
+	latest += (steps * frameTime) + drift;
+	earliest = (earliest > latch - frameTime) ? earliest : latch - frameTime;
+	latest = (latest < latch) ? latest : latch;
+	if (earliest > latest)
+	{
+		earliest = latch - frameTime;
+		latest = latch;
+	}
+	frameStart = (earliest + latest) / 2;
+	return (status);
+}
+
+int32_t Tle5012Predictor::delayMicro()
+{
+	int32_t age = (int32_t) (frameTime / 2) - (prediction ? (int32_t) frameTime : 0);
+	return ((int32_t) readMicro + ((age + ((age < 0) ? -500 : 500)) / 1000));
+}
+
+int32_t Tle5012Predictor::angleAtQ16(uint32_t timestamp)
+{
+	// AVAL is the angle at the start of its update period, or one period later with prediction
+	int64_t time = timeNs + ((int64_t) (int32_t) (timestamp - lastTime) * 1000);
+	int64_t angleTime = frameStart + (prediction ? frameTime : 0);
+	int64_t latency = time - angleTime;
+	return (estimator.predictQ16((int32_t) ((latency + ((latency < 0) ? -500 : 500)) / 1000)));
+}
+
+int32_t Tle5012Predictor::angleNowQ16()
+{
+	uint32_t time = 0;
+	timer->elapsedMicro(time);
+	return (angleAtQ16(time));
+}
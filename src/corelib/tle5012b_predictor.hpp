@@ -0,0 +1,132 @@
+/*!
+ * \file        tle5012b_predictor.hpp
+ * \name        tle5012b_predictor.hpp - latency compensated angle for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              Returns the angle extrapolated to a timestamp of the Timer PAL, e.g. the time the
+ *              control loop applies its output. AVAL is calculated at the start of an update
+ *              period, so at the read it is up to one period old, plus the SSC transfer and the
+ *              processing until the angle is used. calibrate() measures the read time and the
+ *              update period against the timer, and every update keeps the start of the update
+ *              periods in the timer time from the frame counter FCNT. The angle is then
+ *              extrapolated from there with the speed and acceleration of Tle5012Estimator.
+ *              With the prediction of the sensor (Reg::enablePrediction) AVAL is already one
+ *              update period ahead, which is taken into account, so it is not applied twice.
+ * \ref         tle5012predictor
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_PREDICTOR_HPP
+#define TLE5012B_PREDICTOR_HPP
+
+#include <stdint.h>
+#include "TLE5012b.hpp"
+#include "tle5012b_estimator.hpp"
+#include "../pal/timer.hpp"
+
+/**
+ * @addtogroup tle5012predictor
+ *
+ * @{
+ */
+
+#define PREDICTOR_READ_ROUNDS    8          //!< \brief reads timed by calibrate
+#define PREDICTOR_TOLERANCE      10         //!< \brief update period tolerance in percent
+#define PREDICTOR_DRIFT_SHIFT    10         //!< \brief update period uncertainty of 2^-n per period
+
+/*!
+ * Angle at a timestamp from the estimated speed and the measured pipeline delay
+ */
+class Tle5012Predictor
+{
+	public:
+
+		Tle5012Estimator estimator;  //!< \brief speed estimator, e.g. to set the mode or bandwidth
+		uint32_t frameTime;          //!< \brief update period in ns measured by calibrate
+		uint32_t readMicro;          //!< \brief mean time of update() in us measured by calibrate
+		bool     prediction;         //!< \brief prediction of the sensor, AVAL is one update period ahead
+
+		/*!
+		* Constructor
+		* @param [in,out] sensor sensor to read
+		* @param [in,out] timer timer of the timestamps, elapsedMicro is used
+		*/
+		Tle5012Predictor(Tle5012b &sensor, Timer &timer);
+
+		/*!
+		* Reads FIR_MD and the prediction bit, starts the timer like Tle5012Sampler::begin
+		* and calibrates
+		* @return CRC error type, SYSTEM_ERROR if the frame counter does not count
+		*/
+		errorTypes begin();
+
+		/*!
+		* Measures the time of update() and the update period against the timer, needs
+		* the time of the given update periods, call it again after a temperature change
+		* @param [in] frames update periods to time
+		* @return CRC error type, SYSTEM_ERROR if the frame counter does not count or
+		* the update period is more than PREDICTOR_TOLERANCE percent off
+		*/
+		errorTypes calibrate(uint16_t frames=TLE5012_PREDICTOR_FRAMES);
+
+		/*!
+		* Latches AVAL, ASPD and AREV with the update trigger, reads them from the update
+		* buffer and updates the estimation and the update period timing
+		* @return CRC error type
+		*/
+		errorTypes update();
+
+		/*!
+		* Mean delay from the magnet angle of AVAL to the end of update()
+		* @return delay in us, negative if the prediction of the sensor is ahead
+		*/
+		int32_t delayMicro();
+
+		/*!
+		* Angle extrapolated to a timestamp
+		* @param [in] timestamp elapsedMicro time of the timer
+		* @return angle in Q16 turns, 65536 is one turn
+		*/
+		int32_t angleAtQ16(uint32_t timestamp);
+
+		/*!
+		* Angle extrapolated to the actual time of the timer
+		* @return angle in Q16 turns, 65536 is one turn
+		*/
+		int32_t angleNowQ16();
+
+	private:
+
+		Tle5012b *sensor;
+		Timer    *timer;
+		uint32_t  lastTime;          //!< \brief elapsedMicro of the last now()
+		int64_t   timeNs;            //!< \brief timer time in ns without wrap
+		int64_t   frameStart;        //!< \brief start of the update period of the last AVAL in ns of timeNs
+		int64_t   earliest;          //!< \brief earliest possible frameStart
+		int64_t   latest;            //!< \brief latest possible frameStart
+		uint8_t   lastFrame;         //!< \brief FCNT of frameStart
+
+		/*!
+		* Timer time in ns, counts on over the 32 bit wrap of elapsedMicro
+		*/
+		int64_t now();
+
+		/*!
+		* Reads FCNT directly from AREV
+		* @param [out] frame FCNT bits 14:9 of AREV
+		* @param [out] time timer time in ns at the start of the read
+		* @return CRC error type
+		*/
+		errorTypes readFrame(uint8_t &frame, int64_t &time);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_PREDICTOR_HPP */
@@ -164,8 +164,25 @@ const Reg::BitField_t Reg::bitFields[] =
  *
  * @param p nested pointer to parent
  */
-Reg::Reg(void * p): regMap(), parent_(p)
+Reg::Reg(void * p): regMap(), cacheHits(0), cacheMisses(0), parent_(p), configMask_(0), validMask_(0), dirtyMask_(0), transaction_(false)
 {
+	uint32_t updateMask = 0;
+	for (uint8_t i = 0; i < sizeof(bitFields) / sizeof(bitFields[0]); i++)
+	{
+		if (bitFields[i].regAccess == REG_ACCESS_RES)
+		{
+			continue;
+		}
+		if (bitFields[i].regAccess & REG_ACCESS_W)
+		{
+			configMask_ |= (1UL << bitFields[i].posMap);
+		}
+		if (bitFields[i].regAccess & REG_ACCESS_U)
+		{
+			updateMask |= (1UL << bitFields[i].posMap);
+		}
+	}
+	configMask_ &= ~updateMask;
 }
 
 /**
@@ -176,6 +193,188 @@ Reg::~Reg()
 {
 }
 
+/**
+ * @brief Position of a register in regMap and addrFields
+ *
+ * @param regAddress register address
+ * @return position or MAX_NUM_REG if the address is unknown
+ */
+uint8_t Reg::posFromAddress(uint16_t regAddress)
+{
+	uint8_t pos = 0;
+	while ((pos < MAX_NUM_REG) && (addrFields[pos].regAddress != regAddress))
+	{
+		pos++;
+	}
+	return (pos);
+}
+
+/**
+ * @brief Set of registers served from regMap while valid
+ *
+ * @return mask of cacheable registers
+ */
+uint32_t Reg::cacheableMask(void)
+{
+	uint32_t mask = configMask_;
+	// auto-calibration updates the offset and synchronicity registers
+	const BitField_t &autocal = bitFields[REG_MOD_2_AUTOCAL];
+	if (((validMask_ & MASK_MOD_2) == 0) || ((regMap[autocal.posMap] & autocal.mask) != noAutoCal))
+	{
+		mask &= ~(MASK_OFFX | MASK_OFFY | MASK_SYNCH);
+	}
+	return (mask);
+}
+
+/**
+ * @brief Marks registers as valid in regMap
+ *
+ * @param mask set of registers
+ */
+void Reg::validateCache(uint32_t mask)
+{
+	validMask_ |= (mask & configMask_);
+	if (mask & (MASK_MOD_1 | MASK_MOD_2))
+	{
+		static_cast<Tle5012b*>(parent_)->invalidateSpeedScale();
+	}
+}
+
+/**
+ * @brief Marks registers as unknown
+ *
+ * @param mask set of registers
+ */
+void Reg::invalidateCache(uint32_t mask)
+{
+	validMask_ &= ~mask;
+	if (mask & (MASK_MOD_1 | MASK_MOD_2))
+	{
+		static_cast<Tle5012b*>(parent_)->invalidateSpeedScale();
+	}
+}
+
+/**
+ * @brief Starts a write transaction
+ *
+ */
+void Reg::beginTransaction(void)
+{
+	transaction_ = true;
+}
+
+/**
+ * @brief Writes all changed registers and updates the CRC_PAR once
+ *
+ * @return CRC error type of the first failed write
+ */
+errorTypes Reg::commit(void)
+{
+	Tle5012b *p = static_cast<Tle5012b*>(parent_);
+	errorTypes status = NO_ERROR;
+	uint32_t crcMask = dirtyMask_ & MASK_CRC;
+	uint32_t crcWritten = 0;
+
+	transaction_ = false;
+	for (uint8_t i = 0; (i < MAX_NUM_REG) && (dirtyMask_ != 0); i++)
+	{
+		if ((dirtyMask_ & (1UL << i)) == 0)
+		{
+			continue;
+		}
+		// the CRC update follows the last changed register of the CRC range
+		bool changeCRC = (crcMask == (1UL << i));
+		dirtyMask_ &= ~(1UL << i);
+		crcMask &= ~(1UL << i);
+		crcWritten |= (1UL << i) & MASK_CRC;
+		status = p->writeToSensor(addrFields[i].regAddress, regMap[i], changeCRC);
+		if (status != NO_ERROR)
+		{
+			// registers of the CRC range may have changed on the sensor, the failed one
+			// included, so CRC_PAR must follow them or the sensor reports a CRC fault
+			if (crcWritten != 0)
+			{
+				p->regularCrcUpdate();
+			}
+			abortTransaction();
+			break;
+		}
+	}
+	return (status);
+}
+
+/**
+ * @brief Drops all changes of a write transaction
+ *
+ */
+void Reg::abortTransaction(void)
+{
+	transaction_ = false;
+	invalidateCache(dirtyMask_);
+	dirtyMask_ = 0;
+}
+
+/**
+ * @brief Checks if a register is served from regMap
+ *
+ * @param pos position of the register in regMap
+ * @return true if cacheable and valid
+ */
+bool Reg::isCached(uint8_t pos)
+{
+	return ((((validMask_ & cacheableMask()) | dirtyMask_) & (1UL << pos)) != 0);
+}
+
+/**
+ * @brief Returns a whole register from regMap or the sensor
+ *
+ * @param pos position of the register in regMap
+ * @param data register value
+ * @return CRC error type
+ */
+errorTypes Reg::getRegister(uint8_t pos, uint16_t &data)
+{
+	Tle5012b *p = static_cast<Tle5012b*>(parent_);
+	errorTypes status = NO_ERROR;
+	if (isCached(pos))
+	{
+		cacheHits++;
+	}else{
+		cacheMisses++;
+		status = p->readFromSensor(addrFields[pos].regAddress, regMap[pos], UPD_low, SAFE_high);
+		if (status == NO_ERROR)
+		{
+			validateCache(1UL << pos);
+		}
+	}
+	data = regMap[pos];
+	return (status);
+}
+
+/**
+ * @brief       Reads a register from the sensor into regMap
+ *
+ * @param[in]   pos         Position of the register in regMap
+ * @param[in]   update      Trigger an update before reading
+ * @retval      TRUE if the safety word was ok
+ * @retval      FALSE if reading failed
+ */
+bool Reg::fetchRegister(uint8_t pos, bool update)
+{
+	Tle5012b *p = static_cast<Tle5012b*>(parent_);
+	if (update)
+	{
+		p->sBus->triggerUpdate();
+	}
+	cacheMisses++;
+	errorTypes status = p->readFromSensor(addrFields[pos].regAddress, regMap[pos], UPD_low, SAFE_high);
+	if (status == NO_ERROR)
+	{
+		validateCache(1UL << pos);
+	}
+	return (status == NO_ERROR);
+}
+
 /**
  * @brief       Gets the bit field value
  *
@@ -190,12 +389,12 @@ bool Reg::getBitField(BitField_t bitField, uint16_t &bitFValue)
 	bool err = false;
 	if ((REG_ACCESS_R & bitField.regAccess) == REG_ACCESS_R)
 	{
-		Tle5012b *p = static_cast<Tle5012b*>(parent_);
-		if ((REG_ACCESS_U & bitField.regAccess) == REG_ACCESS_U)
+		if (isCached(bitField.posMap))
 		{
-			p->sBus->triggerUpdate();
+			cacheHits++;
+		}else{
+			fetchRegister(bitField.posMap, (REG_ACCESS_U & bitField.regAccess) == REG_ACCESS_U);
 		}
-		p->readFromSensor(addrFields[bitField.posMap].regAddress, regMap[bitField.posMap], UPD_low, SAFE_high);
 		bitFValue = (( regMap[bitField.posMap] & bitField.mask) >> bitField.position);
 		err = true;
 	}
@@ -219,8 +418,20 @@ bool Reg::setBitField(BitField_t bitField, uint16_t bitFNewValue)
 	if ((REG_ACCESS_W & bitField.regAccess) == REG_ACCESS_W)
 	{
 		Tle5012b *p = static_cast<Tle5012b*>(parent_);
+		// the other bit fields of the register must be actual before they are written back
+		if (isCached(bitField.posMap))
+		{
+			cacheHits++;
+		}else{
+			fetchRegister(bitField.posMap, false);
+		}
 		regMap[bitField.posMap] = (regMap[bitField.posMap] & ~bitField.mask) | ((bitFNewValue << bitField.position) & bitField.mask);
-		p->writeToSensor(addrFields[bitField.posMap].regAddress, regMap[bitField.posMap], true);
+		if (transaction_)
+		{
+			dirtyMask_ |= (1UL << bitField.posMap);
+		}else{
+			p->writeToSensor(addrFields[bitField.posMap].regAddress, regMap[bitField.posMap], true);
+		}
 		err = true;
 	}
 
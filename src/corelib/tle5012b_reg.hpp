@@ -149,11 +149,113 @@ class Reg
 			REG_T25O         = (0x0300U)     //!< \brief T25O temperature 25°c offset value
 		};
 
+		/**
+		 * \brief register bit masks, bit n selects regMap[n], used to
+		 * select a set of registers e.g. for Tle5012b::readRegisters
+		 */
+		enum RegMask_t
+		{
+			MASK_STAT        = (1UL << 0),     //!< \brief STAT status register
+			MASK_ACSTAT      = (1UL << 1),     //!< \brief ACSTAT activation status register
+			MASK_AVAL        = (1UL << 2),     //!< \brief AVAL angle value register
+			MASK_ASPD        = (1UL << 3),     //!< \brief ASPD angle speed register
+			MASK_AREV        = (1UL << 4),     //!< \brief AREV angle revolution register
+			MASK_FSYNC       = (1UL << 5),     //!< \brief FSYNC frame synchronization register
+			MASK_MOD_1       = (1UL << 6),     //!< \brief MOD_1 interface mode1 register
+			MASK_SIL         = (1UL << 7),     //!< \brief SIL register
+			MASK_MOD_2       = (1UL << 8),     //!< \brief MOD_2 interface mode2 register
+			MASK_MOD_3       = (1UL << 9),     //!< \brief MOD_3 interface mode3 register
+			MASK_OFFX        = (1UL << 10),    //!< \brief OFFX offset x
+			MASK_OFFY        = (1UL << 11),    //!< \brief OFFY offset y
+			MASK_SYNCH       = (1UL << 12),    //!< \brief SYNCH synchronicity
+			MASK_IFAB        = (1UL << 13),    //!< \brief IFAB register
+			MASK_MOD_4       = (1UL << 14),    //!< \brief MOD_4 interface mode4 register
+			MASK_TCO_Y       = (1UL << 15),    //!< \brief TCO_Y temperature coefficient register
+			MASK_ADC_X       = (1UL << 16),    //!< \brief ADC_X ADC X-raw value
+			MASK_ADC_Y       = (1UL << 17),    //!< \brief ADC_Y ADC Y-raw value
+			MASK_D_MAG       = (1UL << 18),    //!< \brief D_MAG angle vector magnitude
+			MASK_T_RAW       = (1UL << 19),    //!< \brief T_RAW temperature sensor raw-value
+			MASK_IIF_CNT     = (1UL << 20),    //!< \brief IIF_CNT IIF counter value
+			MASK_T25O        = (1UL << 21),    //!< \brief T25O temperature 25°c offset value
+			MASK_CRC         = (0xFFUL << 8),  //!< \brief registers 08 - 0F protected by the CRC_PAR in TCO_Y
+			MASK_ALL         = (1UL << 22) - 1 //!< \brief all registers
+		};
+
 		uint16_t regMap[MAX_NUM_REG];              //!< Register map */
+		uint32_t cacheHits;                        //!< \brief bit field reads served from regMap
+		uint32_t cacheMisses;                      //!< \brief bit field reads which needed a sensor read
 
 		Reg(void* p);
 		~Reg();
 
+		/*!
+		* Returns the set of registers which are served from regMap while they
+		* are valid. These are all registers with write access and without update
+		* access, so MOD_1 to TCO_Y. OFFX, OFFY and SYNCH are excluded while
+		* the cached MOD_2 has auto-calibration switched on, as the sensor
+		* changes them itself. All other registers are always read from the sensor.
+		* @return mask of cacheable registers, see RegMask_t
+		*/
+		uint32_t cacheableMask(void);
+
+		/*!
+		* Marks registers as read from or written to the sensor, so regMap holds their actual value.
+		* A changed MOD_1 or MOD_2 also drops the cached speed scale of the sensor.
+		* @param [in] mask set of registers, see RegMask_t, only cacheable registers are marked
+		*/
+		void validateCache(uint32_t mask);
+
+		/*!
+		* Marks registers as unknown, so they are read again on the next access.
+		* Is called on writes, resets and safety words with STAT_RES set.
+		* @param [in] mask set of registers, see RegMask_t, default all registers
+		*/
+		void invalidateCache(uint32_t mask = MASK_ALL);
+
+		/*!
+		* Starts a write transaction. All following bit field changes are only
+		* stored in regMap until commit(), so each changed register is written
+		* once and the CRC_PAR in TCO_Y is updated once for all of them.
+		*/
+		void beginTransaction(void);
+
+		/*!
+		* Writes all registers changed since beginTransaction() in address order and
+		* updates the CRC_PAR once if a register of the CRC range 08 - 0F was changed.
+		* @return CRC error type of the first failed write, the changed registers are
+		* read again from the sensor on the next access. If registers of the CRC range
+		* were written before or by the failed write, the CRC_PAR is still updated.
+		*/
+		errorTypes commit(void);
+
+		/*!
+		* Drops all changes since beginTransaction(), the changed registers are
+		* read again from the sensor on the next access
+		*/
+		void abortTransaction(void);
+
+		/*!
+		* Checks if a register is served from regMap
+		* @param [in] pos position of the register in regMap
+		* @return true if regMap holds the actual value
+		*/
+		bool isCached(uint8_t pos);
+
+		/*!
+		* Returns a whole register, served from regMap if cached, otherwise read from the sensor
+		* @param [in] pos position of the register in regMap
+		* @param [in,out] data register value
+		* @return CRC error type
+		*/
+		errorTypes getRegister(uint8_t pos, uint16_t &data);
+
+		/*!
+		* Returns the position of a register in regMap and addrFields
+		* @param [in] regAddress register address, e.g. REG_MOD_2
+		* @return position or MAX_NUM_REG if the address is unknown
+		*/
+		static uint8_t posFromAddress(uint16_t regAddress);
+
 		// REG_STAT
 		bool isStatusReset(void);
 		bool isStatusWatchDog(void);
@@ -450,8 +552,13 @@ class Reg
 
 		bool getBitField (BitField_t bitField, uint16_t & bitFValue);
 		bool setBitField (BitField_t bitField, uint16_t bitFNewValue);
+		bool fetchRegister (uint8_t pos, bool update);
 
 		void* parent_;
+		uint32_t configMask_;                   //!< \brief registers with write and without update access
+		uint32_t validMask_;                    //!< \brief registers with valid values in regMap
+		uint32_t dirtyMask_;                    //!< \brief registers changed in regMap but not yet written
+		bool     transaction_;                  //!< \brief true between beginTransaction() and commit()
 
 };
 
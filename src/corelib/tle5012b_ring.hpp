@@ -0,0 +1,217 @@
+/*!
+ * \file        tle5012b_ring.hpp
+ * \name        tle5012b_ring.hpp - sample ring buffer for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              Lock free single producer, single consumer ring of fixed size sample records,
+ *              which decouples the sampling context, e.g. an ISR or a high priority task, from
+ *              slow consumers like serial output, logging or control math. The producer only
+ *              writes the head index and the consumer only the tail index, both with the GCC
+ *              __atomic builtins, as the standard <atomic> header is missing on AVR and XMC.
+ *              AVR has no lock free 16 and 32 bit atomics, there the indexes and the overrun
+ *              counter are copied in an ATOMIC_BLOCK with the interrupts disabled instead. The
+ *              indexes run freely over 16 bit and are masked with the power of two size. A
+ *              full ring drops the new sample and counts it.
+ * \ref         tle5012ring
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_RING_HPP
+#define TLE5012B_RING_HPP
+
+#include <stdint.h>
+#include "TLE5012b.hpp"
+#if defined(__AVR__)
+#include <util/atomic.h>
+#endif
+
+/**
+ * @addtogroup tle5012ring
+ *
+ * @{
+ */
+
+/*!
+ * One sample record, 16 bytes
+ */
+struct ringSample
+{
+	uint32_t timestamp;          //!< \brief sample time, e.g. in us from Tle5012Sampler
+	int16_t  rawAngle;           //!< \brief AVAL bits 14:0 signed angle value
+	int16_t  rawSpeed;           //!< \brief ASPD bits 14:0 signed angle speed
+	int16_t  revolutions;        //!< \brief AREV bits 8:0 signed number of revolutions
+	uint16_t safety;             //!< \brief safety word of the read
+	uint8_t  frameCounter;       //!< \brief AREV bits 14:9 FCNT
+	uint8_t  status;             //!< \brief errorTypes of the read
+	uint16_t reserved;           //!< \brief keeps the record at 16 bytes
+
+	/*!
+	* Fills the record from a motion snapshot
+	* @param [in] snapshot values of the read
+	* @param [in] safetyWord safety word of the read
+	* @param [in] error error of the read
+	* @param [in] time sample time
+	*/
+	void set(const Tle5012b::motionSnapshot &snapshot, uint16_t safetyWord, errorTypes error, uint32_t time)
+	{
+		timestamp = time;
+		rawAngle = snapshot.rawAngle;
+		rawSpeed = snapshot.rawSpeed;
+		revolutions = snapshot.revolutions;
+		safety = safetyWord;
+		frameCounter = snapshot.frameCounter;
+		status = (uint8_t) error;
+		reserved = 0;
+	}
+};
+
+/*!
+ * Single producer, single consumer ring of SIZE sample records
+ * \tparam SIZE number of records, a power of two from 2 to 32768
+ */
+template<uint16_t SIZE>
+class Tle5012Ring
+{
+	static_assert((SIZE >= 2) && (SIZE <= 32768) && ((SIZE & (SIZE - 1)) == 0), "ring size must be a power of two");
+
+	public:
+
+		Tle5012Ring(): head(0), tail(0), overrunCount(0)
+		{
+		}
+
+		/*!
+		* Adds a record, producer only
+		* @param [in] sample record to add
+		* @return false if the ring is full, the record is dropped and counted
+		*/
+		bool push(const ringSample &sample)
+		{
+			uint16_t h = head;
+			uint16_t t = load(&tail);
+			if ((uint16_t) (h - t) >= SIZE)
+			{
+				store(&overrunCount, (uint32_t) (overrunCount + 1));
+				return (false);
+			}
+			records[h & (SIZE - 1)] = sample;
+			store(&head, (uint16_t) (h + 1));
+			return (true);
+		}
+
+		/*!
+		* Takes the oldest record, consumer only
+		* @param [out] sample the record
+		* @return false if the ring is empty
+		*/
+		bool pop(ringSample &sample)
+		{
+			return (popBatch(&sample, 1) == 1);
+		}
+
+		/*!
+		* Takes up to maxCount of the oldest records at once, consumer only
+		* @param [out] samples buffer for the records
+		* @param [in] maxCount size of the buffer
+		* @return number of records taken
+		*/
+		uint16_t popBatch(ringSample samples[], uint16_t maxCount)
+		{
+			uint16_t t = tail;
+			uint16_t h = load(&head);
+			uint16_t count = (uint16_t) (h - t);
+			if (count > maxCount)
+			{
+				count = maxCount;
+			}
+			for (uint16_t i = 0; i < count; i++)
+			{
+				samples[i] = records[(uint16_t) (t + i) & (SIZE - 1)];
+			}
+			store(&tail, (uint16_t) (t + count));
+			return (count);
+		}
+
+		/*!
+		* Number of records in the ring, exact for the consumer
+		* @return records ready to pop
+		*/
+		uint16_t available()
+		{
+			return ((uint16_t) (load(&head) - load(&tail)));
+		}
+
+		/*!
+		* Records dropped because the ring was full
+		* @return number of dropped records
+		*/
+		uint32_t overruns()
+		{
+			return (load(&overrunCount));
+		}
+
+		/*!
+		* Ring size
+		* @return number of records
+		*/
+		uint16_t capacity()
+		{
+			return (SIZE);
+		}
+
+	private:
+
+		ringSample records[SIZE];    //!< \brief record storage
+		uint16_t   head;             //!< \brief next record to write, written by the producer only
+		uint16_t   tail;             //!< \brief next record to read, written by the consumer only
+		uint32_t   overrunCount;     //!< \brief dropped records, written by the producer only
+
+		/*!
+		* Reads an index or the counter written by the other side
+		* @param [in] value the index or counter
+		* @return its value
+		*/
+		template<typename T>
+		static T load(T *value)
+		{
+		#if defined(__AVR__)
+			T copy;
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				copy = *(volatile T *) value;
+			}
+			return (copy);
+		#else
+			return (__atomic_load_n(value, __ATOMIC_ACQUIRE));
+		#endif
+		}
+
+		/*!
+		* Writes an index or the counter for the other side
+		* @param [out] value the index or counter
+		* @param [in] data new value
+		*/
+		template<typename T>
+		static void store(T *value, T data)
+		{
+		#if defined(__AVR__)
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				*(volatile T *) value = data;
+			}
+		#else
+			__atomic_store_n(value, data, __ATOMIC_RELEASE);
+		#endif
+		}
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_RING_HPP */
@@ -0,0 +1,172 @@
+/*!
+ * \file        tle5012b_sampler.cpp
+ * \name        tle5012b_sampler.cpp - fixed rate sampling for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012sampler
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_sampler.hpp"
+
+//-----------------------------------------------------------------------------
+// begin statistics functions
+void samplerStats::reset(uint16_t bucketStep)
+{
+	count = 0;
+	min = 0;
+	max = 0;
+	sum = 0;
+	step = (bucketStep > 0) ? bucketStep : 1;
+	for (uint8_t i = 0; i < TLE5012_SAMPLER_BUCKETS; i++)
+	{
+		histogram[i] = 0;
+	}
+}
+
+void samplerStats::add(int32_t value)
+{
+	if ((count == 0) || (value < min))
+	{
+		min = value;
+	}
+	if ((count == 0) || (value > max))
+	{
+		max = value;
+	}
+	count++;
+	sum += value;
+	uint32_t bucket = (uint32_t) ((value < 0) ? -value : value) / step;
+	histogram[(bucket < TLE5012_SAMPLER_BUCKETS) ? bucket : (TLE5012_SAMPLER_BUCKETS - 1)]++;
+}
+
+int32_t samplerStats::mean()
+{
+	return ((count > 0) ? (int32_t) (sum / (int64_t) count) : 0);
+}
+
+uint32_t samplerStats::percentile(uint8_t percent)
+{
+	uint32_t needed = (uint32_t) ((((uint64_t) count * percent) + 99) / 100);
+	uint32_t seen = 0;
+	for (uint8_t i = 0; i < TLE5012_SAMPLER_BUCKETS - 1; i++)
+	{
+		seen += histogram[i];
+		if (seen >= needed)
+		{
+			return ((uint32_t) (i + 1) * step);
+		}
+	}
+	uint32_t low = (uint32_t) ((min < 0) ? -min : min);
+	uint32_t high = (uint32_t) ((max < 0) ? -max : max);
+	return ((low > high) ? low : high);
+}
+// end statistics functions
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// begin sampler functions
+/*!
+ * Default read function of the samples
+ */
+static errorTypes readAngle(Tle5012b &sensor, int32_t &value, void *context)
+{
+	(void) context;
+	return (sensor.getAngleQ16(value));
+}
+
+Tle5012Sampler::Tle5012Sampler(Tle5012b &sensor, Timer &timer)
+{
+	this->sensor = &sensor;
+	this->timer = &timer;
+	readFunc = readAngle;
+	readContext = NULL;
+	period = 0;
+	nextTime = 0;
+	nextIndex = 0;
+	lastTime = 0;
+	lastIndex = 0;
+	hasLast = false;
+	jitter.reset(1);
+	latency.reset(1);
+	missed = 0;
+}
+
+void Tle5012Sampler::begin(uint32_t periodMicro, uint16_t stepMicro)
+{
+	period = periodMicro;
+	jitter.reset(stepMicro);
+	latency.reset(stepMicro);
+	missed = 0;
+	hasLast = false;
+	nextIndex = 0;
+	timer->start();
+	nextTime = now();
+}
+
+void Tle5012Sampler::setRead(readFunc_t func, void *context)
+{
+	readFunc = (func != NULL) ? func : readAngle;
+	readContext = context;
+}
+
+void Tle5012Sampler::resetStats()
+{
+	jitter.reset(jitter.step);
+	latency.reset(latency.step);
+	missed = 0;
+}
+
+uint32_t Tle5012Sampler::now()
+{
+	uint32_t time = 0;
+	timer->elapsedMicro(time);
+	return (time);
+}
+
+errorTypes Tle5012Sampler::next(sample &s)
+{
+	uint32_t time = now();
+	int32_t wait = (int32_t) (nextTime - time);
+	if (wait > 0)
+	{
+		timer->delayMicro((uint32_t) wait);
+		time = now();
+	}
+	// more than one period late, also after a long delay, continue on the grid with the actual period
+	uint32_t late = time - nextTime;
+	if (((int32_t) late > 0) && (late >= period))
+	{
+		uint32_t skipped = late / period;
+		missed += skipped;
+		nextIndex += skipped;
+		nextTime += skipped * period;
+	}
+
+	s.index = nextIndex;
+	s.time = time;
+	s.status = readFunc(*sensor, s.value, readContext);
+	s.latency = now() - time;
+	latency.add((int32_t) s.latency);
+
+	// the period jitter only between samples of consecutive periods
+	if (hasLast && (nextIndex == lastIndex + 1))
+	{
+		jitter.add((int32_t) (time - lastTime - period));
+	}
+	hasLast = true;
+	lastTime = time;
+	lastIndex = nextIndex;
+
+	// the grid is fixed to the start, so late samples do not drift
+	nextIndex++;
+	nextTime += period;
+	return (s.status);
+}
+// end sampler functions
+//-----------------------------------------------------------------------------
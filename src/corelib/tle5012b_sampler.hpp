@@ -0,0 +1,155 @@
+/*!
+ * \file        tle5012b_sampler.hpp
+ * \name        tle5012b_sampler.hpp - fixed rate sampling for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              Reads the sensor at a fixed period on the Timer PAL instead of a delay in the
+ *              loop, so the sample rate does not drift with the SPI and serial time. The sample
+ *              times are scheduled on a fixed grid from the start, late samples do not shift the
+ *              following ones and missed periods are counted. Every sample carries its timestamp
+ *              and read latency, and the period jitter and the read latency are kept as running
+ *              min/max/mean with a fixed size histogram for percentiles.
+ * \ref         tle5012sampler
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_SAMPLER_HPP
+#define TLE5012B_SAMPLER_HPP
+
+#include <stdint.h>
+#include "TLE5012b.hpp"
+#include "../pal/timer.hpp"
+
+/**
+ * @addtogroup tle5012sampler
+ *
+ * @{
+ */
+
+/*!
+ * Statistics of a time in us with running min/max/mean and a histogram of the
+ * absolute values for percentiles. Bucket n counts values below (n + 1) * step,
+ * the last bucket all larger values.
+ */
+struct samplerStats
+{
+	uint32_t count;                                   //!< \brief number of values
+	int32_t  min;                                     //!< \brief smallest value
+	int32_t  max;                                     //!< \brief largest value
+	int64_t  sum;                                     //!< \brief sum of the values
+	uint16_t step;                                    //!< \brief histogram bucket width in us
+	uint32_t histogram[TLE5012_SAMPLER_BUCKETS];      //!< \brief histogram of the absolute values
+
+	/*!
+	* Clears the statistics
+	* @param [in] bucketStep histogram bucket width in us
+	*/
+	void reset(uint16_t bucketStep);
+
+	/*!
+	* Adds a value
+	* @param [in] value time in us
+	*/
+	void add(int32_t value);
+
+	/*!
+	* Mean of the values
+	* @return mean in us, 0 without values
+	*/
+	int32_t mean();
+
+	/*!
+	* Percentile of the absolute values from the histogram
+	* @param [in] percent e.g. 99 for p99
+	* @return upper bound of the bucket in us, max(|min|, |max|) if it is the last bucket
+	*/
+	uint32_t percentile(uint8_t percent);
+};
+
+/*!
+ * Sampler which reads a Tle5012b at a fixed period
+ */
+class Tle5012Sampler
+{
+	public:
+
+		/*!
+		* Read function of a sample, the default reads the angle with getAngleQ16
+		* @param [in,out] sensor sensor to read
+		* @param [out] value sample value
+		* @param [in] context as given to setRead
+		* @return the error of the read
+		*/
+		typedef errorTypes (*readFunc_t)(Tle5012b &sensor, int32_t &value, void *context);
+
+		struct sample {
+			uint32_t   index;        //!< \brief number of the period since begin
+			uint32_t   time;         //!< \brief start of the read in us since begin
+			uint32_t   latency;      //!< \brief duration of the read in us
+			int32_t    value;        //!< \brief read value, the angle in Q16 turns by default
+			errorTypes status;       //!< \brief error of the read
+		};
+
+		samplerStats jitter;         //!< \brief deviation of the time between two consecutive samples from the period in us
+		samplerStats latency;        //!< \brief read latency in us
+		uint32_t     missed;         //!< \brief periods skipped because a sample was late for more than one period
+
+		/*!
+		* Constructor of the sampler
+		* @param [in] sensor sensor to read
+		* @param [in] timer timer with a microsecond clock, see Timer::elapsedMicro
+		*/
+		Tle5012Sampler(Tle5012b &sensor, Timer &timer);
+
+		/*!
+		* Starts the timer and the sampling grid, the first sample is taken right away
+		* @param [in] periodMicro sample period in us
+		* @param [in] stepMicro histogram bucket width in us
+		*/
+		void begin(uint32_t periodMicro, uint16_t stepMicro = 1);
+
+		/*!
+		* Sets the read function of the samples
+		* @param [in] func read function, NULL for getAngleQ16
+		* @param [in] context passed to func
+		*/
+		void setRead(readFunc_t func, void *context);
+
+		/*!
+		* Waits for the next period and takes a sample
+		* @param [out] s the sample
+		* @return the error of the read
+		*/
+		errorTypes next(sample &s);
+
+		/*!
+		* Clears the jitter and latency statistics and the missed periods
+		*/
+		void resetStats();
+
+	private:
+
+		Tle5012b   *sensor;
+		Timer      *timer;
+		readFunc_t  readFunc;
+		void       *readContext;
+		uint32_t    period;
+		uint32_t    nextTime;        //!< \brief scheduled time of the next sample
+		uint32_t    nextIndex;       //!< \brief period number of the next sample
+		uint32_t    lastTime;        //!< \brief time of the last sample
+		uint32_t    lastIndex;       //!< \brief period number of the last sample
+		bool        hasLast;
+
+		uint32_t    now();
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_SAMPLER_HPP */
@@ -23,7 +23,6 @@
 
 #include <stdint.h>
 #include <stdlib.h>
-#include "TLE5012b.hpp"
 
 /**
  * @addtogroup tle5012util
@@ -43,12 +42,21 @@
 #define SYSTEM_ERROR_MASK           0x4000    //!< \brief System error masks for safety words
 #define INTERFACE_ERROR_MASK        0x2000    //!< \brief Interface error masks for safety words
 #define INV_ANGLE_ERROR_MASK        0x1000    //!< \brief Angle error masks for safety words
+#define CHIP_RESET_MASK             0x8000    //!< \brief Chip reset or watchdog overflow mask for safety words
+
+#define ACSTAT_RESET_MASK           0x0401    //!< \brief ASFRST firmware reset and ASRST hardware reset bits of ACSTAT
+#define SIL_FUSEREL_MASK            0x0400    //!< \brief FUSEREL fuse reload bit of SIL
+#define REG_ADDRESS_MASK            0x03F0    //!< \brief register address bits of the command word
 
 #define CRC_POLYNOMIAL              0x1D      //!< \brief values used for calculating the CRC
 #define CRC_SEED                    0xFF
 #define CRC_NUM_REGISTERS           0x0008    //!< \brief number of CRC relevant registers
 #define MAX_REGISTER_MEM            0x0030    //!< \brief max readable register values buffer
 #define MAX_NUM_REG                 0x16      //!< \brief defines the value for temporary data to read all readable registers
+#define MOTION_NUM_REGISTERS        0x0004    //!< \brief number of motion registers AVAL, ASPD, AREV and FSYNC read in one burst
+#define MAX_BURST_LENGTH            0x000F    //!< \brief max number of registers of one burst read, limited by the 4 bit length field
+#define MAX_PLAN_BURSTS             0x000A    //!< \brief max number of burst reads of one read plan
+#define MAX_PLAN_GAP                0x0002    //!< \brief max number of not requested registers read to merge two bursts
 
 #define DELETE_BIT_15               0x7FFF    //!< \brief Value used to delete everything except the first 15 bits
 #define CHANGE_UINT_TO_INT_15       0x8000    //!< \brief Value used to change unsigned 16bit integer into signed
@@ -58,6 +66,8 @@
 #define DELETE_7BITS                0x01FF    //!< \brief values used to calculate 9 bit signed integer sent by the sensor
 #define CHANGE_UNIT_TO_INT_9        0x0200    //!< \brief Value used to change unsigned 9bit integer into signed
 #define CHECK_BIT_9                 0x0100
+#define GET_BIT_14_9                0x7E00    //!< \brief frame counter bits of the AREV register
+#define GET_BIT_15_9                0xFE00    //!< \brief frame synchronization bits of the FSYNC register
 
 #define POW_2_15                    32768.0   //!< \brief values used to for final calculations of angle speed, revolutions, range and value
 #define POW_2_7                     128.0     //!< \brief
@@ -66,6 +76,11 @@
 #define TEMP_OFFSET                 152.0     //!< \brief values used to calculate the temperature
 #define TEMP_DIV                    2.776
 
+#define ANGLE_Q16_FACTOR            2               //!< \brief raw angle in 1/32768 turns to Q16 turns
+#define TEMP_OFFSET_INT             152             //!< \brief integer temperature offset
+#define TEMP_FACTOR_Q16             23608           //!< \brief 65536 / 2.776 rounded, gives Q8 °C from (raw + offset) after >> 8
+#define SPEED_CDEG_FACTOR           1406250000LL    //!< \brief 360 * 128 * 100 * 10^7 / 32768, speed in cdeg/s with the FIR_MD update time in 0.1 µs
+
 /**
  * @brief Error types from safety word
  */
@@ -76,9 +91,31 @@ enum errorTypes
 	INTERFACE_ACCESS_ERROR = 0x02,  //!< \brief INTERFACE_ACCESS_ERROR = wrong address or wrong lock
 	INVALID_ANGLE_ERROR    = 0x03,  //!< \brief INVALID_ANGLE_ERROR = NO_GMR_A = 1 or NO_GMR_XY = 1
 	ANGLE_SPEED_ERROR      = 0x04,  //!< \brief ANGLE_SPEED_ERROR = combined error, angular speed calculation wrong
+	BUFFER_SIZE_ERROR      = 0x05,  //!< \brief BUFFER_SIZE_ERROR = caller buffer too small for the registers and the safety word
 	CRC_ERROR              = 0xFF   //!< \brief CRC_ERROR = Cyclic Redundancy Check (CRC), which includes the STAT and RESP bits wrong
 };
 
+//!< \brief compile time index sequence used to generate the CRC and sine tables
+template<uint16_t... I> struct Tle5012Seq {};
+
+//!< \brief appends the second sequence, shifted by the length of the first one
+template<typename A, typename B> struct Tle5012JoinSeq;
+template<uint16_t... A, uint16_t... B> struct Tle5012JoinSeq<Tle5012Seq<A...>, Tle5012Seq<B...> >
+{
+	typedef Tle5012Seq<A..., (uint16_t) (sizeof...(A) + B)...> type;
+};
+
+//!< \brief generates the index sequence 0 .. N-1 from two halves, so the template depth is only log2(N)
+template<uint16_t N> struct Tle5012MakeSeq : Tle5012JoinSeq<typename Tle5012MakeSeq<N / 2>::type, typename Tle5012MakeSeq<N - N / 2>::type> {};
+template<> struct Tle5012MakeSeq<0>
+{
+	typedef Tle5012Seq<> type;
+};
+template<> struct Tle5012MakeSeq<1>
+{
+	typedef Tle5012Seq<0> type;
+};
+
 //!< \brief Set the UPDate bit high (read from update buffer) or low (read directly)
 enum updTypes
 {
@@ -9,6 +9,7 @@
 
 
 #include "spi3w-ino.hpp"
+#include "../../../corelib/tle5012b_crc.hpp"
 
 #if (TLE5012_FRAMEWORK == TLE5012_FRMWK_ARDUINO)
 #if (SPI3W_INO == SPI3W_ARD)
@@ -78,32 +79,59 @@ void SPIClass3W::setCSPin(uint8_t cs)
  * @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
  * @param received_data pointer to data structure buffer for the read data
  * @param size_of_received_data size of data words to be read
+ * @param crc optional CRC context, all received words except the last one, the safety word, are folded in
  */
-void SPIClass3W::sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+void SPIClass3W::sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t *crc)
+{
+	SPIC::Command_t command = { sent_data, size_of_sent_data, received_data, size_of_received_data, crc };
+	sendReceiveList(&command, 1);
+}
+
+/*!
+ * @brief Runs a list of commands in one SPI transaction. MISO is set up once, only
+ * MOSI changes its direction for each command, and the chip select is pulsed
+ * between the commands as the sensor ends each command with it.
+ *
+ * @param commands [in,out] commands in the order of the transfers, see SPIC::Command_t
+ * @param count [in] number of commands
+ */
+void SPIClass3W::sendReceiveList(SPIC::Command_t *commands, uint8_t count)
 {
 	uint32_t data_index = 0;
-	//send via TX
 	pinMode(this->mMISO,INPUT);
-	pinMode(this->mMOSI,OUTPUT);
-	digitalWrite(this->mCS, LOW);
 	beginTransaction(SPISettings(SPEED,MSBFIRST,SPI_MODE1));
 
-	for(data_index = 0; data_index < size_of_sent_data; data_index++)
+	for(uint8_t i = 0; i < count; i++)
 	{
-		received_data[0] = transfer16(sent_data[data_index]);
-	}
+		SPIC::Command_t &command = commands[i];
+		//send via TX
+		pinMode(this->mMOSI,OUTPUT);
+		if (i > 0)
+		{
+			delayMicroseconds(SPI3W_CS_OFF_US);
+		}
+		digitalWrite(this->mCS, LOW);
 
-	// receive via RX
-	pinMode(this->mMISO,OUTPUT);
-	pinMode(this->mMOSI,INPUT);
-	delayMicroseconds(5);
+		for(data_index = 0; data_index < command.sentSize; data_index++)
+		{
+			command.received[0] = transfer16(command.sent[data_index]);
+		}
 
-	for(data_index = 0; data_index < size_of_received_data; data_index++)
-	{
-		received_data[data_index] = transfer16(0x0000);
+		// receive via RX
+		pinMode(this->mMOSI,INPUT);
+		delayMicroseconds(SPI3W_TURNAROUND_US);
+
+		for(data_index = 0; data_index < command.receivedSize; data_index++)
+		{
+			command.received[data_index] = transfer16(0x0000);
+			if ((command.crc != NULL) && (data_index + 1 < command.receivedSize))
+			{
+				crcUpdateWord(*command.crc, command.received[data_index]);
+			}
+		}
+		digitalWrite(this->mCS, HIGH);
 	}
 	endTransaction();
-	digitalWrite(this->mCS, HIGH);
 }
 
 /** @} */
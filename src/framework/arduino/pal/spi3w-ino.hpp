@@ -7,6 +7,8 @@
  * SPDX-License-Identifier: MIT
  */
 #include "../../../config/tle5012-conf.hpp"
+#include "../../../corelib/tle5012b_crc.hpp"
+#include "../../../pal/spic.hpp"
 
 #if (TLE5012_FRAMEWORK == TLE5012_FRMWK_ARDUINO)
 
@@ -38,6 +40,12 @@
 
 #define MAX_SLAVE_NUM    4              //!< Maximum numbers of slaves on one SPI bus
 #define SPEED            1000000U       //!< default speed of SPI transfer
+#define SPI3W_TURNAROUND_US    5        //!< wait after the data line changes from send to receive
+#define SPI3W_CS_OFF_US        1        //!< min chip select high time between two commands of a list
+#define SPI3W_XMC_FIFO_TX      32       //!< USIC FIFO buffer position of the 16 word transmit FIFO of the async transfers
+#define SPI3W_XMC_FIFO_RX      48       //!< USIC FIFO buffer position of the 16 word receive FIFO of the async transfers
+#define SPI3W_XMC_SR           5        //!< USIC service request of the async transfers, see the USICx_5_IRQHandler
+#define SPI3W_XMC_FIFO_WORDS   16       //!< max command and response words of one command of the async transfers
 
 class SPIClass3W : public SPIClass
 {
@@ -57,7 +65,14 @@ class SPIClass3W : public SPIClass
 				~SPIClass3W();
 		void    begin(uint8_t miso, uint8_t mosi, uint8_t sck, uint8_t cs);
 		void    setCSPin(uint8_t cs);
-		void    sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		void    sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t *crc = NULL);
+		void    sendReceiveList(SPIC::Command_t *commands, uint8_t count);
+
+		#if defined(UC_FAMILY) && (UC_FAMILY == 1 || UC_FAMILY == 4) && (TLE5012_XMC_ASYNC == 1)
+			bool    sendReceiveListAsync(SPIC::Command_t *commands, uint8_t count, SPIC::Callback_t callback, void *context);
+			bool    isBusy();
+			static void handleInterrupt();   //!< USIC receive FIFO service request of the running async transfer
+		#endif
 
 	private:
 
@@ -92,6 +107,20 @@ class SPIClass3W : public SPIClass
 
 			void setupSPI();             //!< initial 3-Wire SPI setup
 			void initSpi();              //!< initial startup of the 3-Wire SPI interface
+
+			#if (TLE5012_XMC_ASYNC == 1)
+				SPIC::Command_t  *mAsyncCommands;     //!< commands of the running async transfer
+				uint8_t           mAsyncCount;        //!< number of commands
+				uint8_t           mAsyncIndex;        //!< actual command
+				bool              mAsyncReceiving;    //!< the actual command is in its response
+				SPIC::Callback_t  mAsyncCallback;     //!< completion callback
+				void             *mAsyncContext;      //!< context of the callback
+
+				static SPIClass3W * volatile mAsyncActive;    //!< instance of the running async transfer, one at a time, cleared in the interrupt
+				void asyncCommand();                  //!< starts the actual command
+				void asyncReceive();                  //!< reads a FIFO and goes on with the command
+				IRQn_Type asyncIrq();                 //!< interrupt of the service request of the channel
+			#endif
 		#endif
 };
 
@@ -9,6 +9,7 @@
 
 
 #include "spi3w-ino.hpp"
+#include "../../../corelib/tle5012b_crc.hpp"
 
 #if (TLE5012_FRAMEWORK == TLE5012_FRMWK_ARDUINO)
 #if (SPI3W_INO == SPI3W_XMC)
@@ -175,41 +176,271 @@ void SPIClass3W::initSpi()
  * @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
  * @param received_data pointer to data structure buffer for the read data
  * @param size_of_received_data size of data words to be read
+ * @param crc optional CRC context, all received words except the last one, the safety word, are folded in
  */
-void SPIClass3W::sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+void SPIClass3W::sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t *crc)
+{
+	SPIC::Command_t command = { sent_data, size_of_sent_data, received_data, size_of_received_data, crc };
+	sendReceiveList(&command, 1);
+}
+
+/*!
+ * @brief Runs a list of commands in one go. MISO stays tristate input, only MOSI
+ * changes between push-pull and tristate for each command, and the chip select
+ * is pulsed between the commands as the sensor ends each command with it.
+ *
+ * @param commands [in,out] commands in the order of the transfers, see SPIC::Command_t
+ * @param count [in] number of commands
+ */
+void SPIClass3W::sendReceiveList(SPIC::Command_t *commands, uint8_t count)
 {
 	uint32_t data_index = 0;
+	XMC_GPIO_Init(m3Wire.miso.port, m3Wire.miso.pin, &m3Wire.miso_open);
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		SPIC::Command_t &command = commands[i];
+		//send via TX
+		XMC_GPIO_Init(m3Wire.mosi.port, m3Wire.mosi.pin, &m3Wire.mosi_open);
+		if (i > 0)
+		{
+			delayMicroseconds(SPI3W_CS_OFF_US);
+		}
+		XMC_GPIO_SetOutputLevel(m3Wire.cs.port, m3Wire.cs.pin,XMC_GPIO_OUTPUT_LEVEL_LOW);
+
+		for(data_index = 0; data_index < command.sentSize; data_index++)
+		{
+			XMC_SPI_CH_Transmit(m3Wire.channel, command.sent[data_index], XMC_SPI_CH_MODE_STANDARD);
+			while((XMC_SPI_CH_GetStatusFlag(m3Wire.channel) & XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION) == 0U);
+			XMC_SPI_CH_ClearStatusFlag(m3Wire.channel, XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION);
+			while (XMC_USIC_CH_GetReceiveBufferStatus(m3Wire.channel) == 0U);
+			command.received[0] = XMC_SPI_CH_GetReceivedData(m3Wire.channel);
+		}
+
+		// receive via RX
+		XMC_GPIO_Init(m3Wire.mosi.port, m3Wire.mosi.pin, &m3Wire.mosi_close);
+		delayMicroseconds(SPI3W_TURNAROUND_US);
+
+		for(data_index = 0; data_index < command.receivedSize; data_index++)
+		{
+			XMC_SPI_CH_Transmit(m3Wire.channel, 0x0000, XMC_SPI_CH_MODE_STANDARD);
+			// fold the previous word into the CRC while this one is shifted in
+			if ((command.crc != NULL) && (data_index > 0))
+			{
+				crcUpdateWord(*command.crc, command.received[data_index - 1]);
+			}
+			while((XMC_SPI_CH_GetStatusFlag(m3Wire.channel) & XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION) == 0U);
+			XMC_SPI_CH_ClearStatusFlag(m3Wire.channel, XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION);
+			while (XMC_USIC_CH_GetReceiveBufferStatus(m3Wire.channel) == 0U);
+			command.received[data_index] = XMC_SPI_CH_GetReceivedData(m3Wire.channel);
+		}
+
+		XMC_GPIO_SetOutputLevel(m3Wire.cs.port, m3Wire.cs.pin,XMC_GPIO_OUTPUT_LEVEL_HIGH);
+	}
+}
+
+#if (TLE5012_XMC_ASYNC == 1)
+
+SPIClass3W * volatile SPIClass3W::mAsyncActive = NULL;
+
+/*!
+ * @brief Starts a list of commands on the USIC FIFOs and returns. The words of a
+ * command and the zeros clocking its response go into the transmit FIFO, the receive
+ * FIFO raises the service request when all words of the command or of the response
+ * are in, and the interrupt reads them, changes the data line direction and starts the
+ * next step. The turnaround wait of SPI3W_TURNAROUND_US per command and the chip select
+ * pause of SPI3W_CS_OFF_US between two commands are busy waits in the interrupt,
+ * everything else runs in the FIFOs.
+ *
+ * @param commands [in,out] commands in the order of the transfers, must stay valid until the callback
+ * @param count [in] number of commands, each with 1 to SPI3W_XMC_FIFO_WORDS command and response words
+ * @param callback [in] called in the interrupt when all commands are done, or NULL
+ * @param context [in] passed to the callback
+ * @return true if started, false if an async transfer is still running or a command does not fit the FIFOs
+ */
+bool SPIClass3W::sendReceiveListAsync(SPIC::Command_t *commands, uint8_t count, SPIC::Callback_t callback, void *context)
+{
+	if (mAsyncActive != NULL)
+	{
+		return false;
+	}
+	// the FIFO trigger limit fires on the last word, so a command must fill neither FIFO beyond it nor leave it empty
+	for (uint8_t i = 0; i < count; i++)
+	{
+		if ((commands[i].sentSize == 0) || (commands[i].sentSize > SPI3W_XMC_FIFO_WORDS)
+			|| (commands[i].receivedSize == 0) || (commands[i].receivedSize > SPI3W_XMC_FIFO_WORDS))
+		{
+			return false;
+		}
+	}
+	if (count == 0)
+	{
+		if (callback != NULL)
+		{
+			callback(SPIC::OK, context);
+		}
+		return true;
+	}
+	mAsyncActive = this;
+	mAsyncCommands = commands;
+	mAsyncCount = count;
+	mAsyncIndex = 0;
+	mAsyncCallback = callback;
+	mAsyncContext = context;
+
+	XMC_USIC_CH_TXFIFO_Configure(m3Wire.channel, SPI3W_XMC_FIFO_TX, XMC_USIC_CH_FIFO_SIZE_16WORDS, 0U);
+	XMC_USIC_CH_RXFIFO_Configure(m3Wire.channel, SPI3W_XMC_FIFO_RX, XMC_USIC_CH_FIFO_SIZE_16WORDS, 0U);
+	XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(m3Wire.channel, XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_STANDARD, SPI3W_XMC_SR);
+	XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(m3Wire.channel, XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_ALTERNATE, SPI3W_XMC_SR);
+	XMC_USIC_CH_RXFIFO_EnableEvent(m3Wire.channel, XMC_USIC_CH_RXFIFO_EVENT_CONF_STANDARD | XMC_USIC_CH_RXFIFO_EVENT_CONF_ALTERNATE);
+	NVIC_ClearPendingIRQ(asyncIrq());
+	NVIC_EnableIRQ(asyncIrq());
+
+	XMC_GPIO_Init(m3Wire.miso.port, m3Wire.miso.pin, &m3Wire.miso_open);
+	asyncCommand();
+	return true;
+}
+
+/*!
+ * @brief Checks for a running async transfer of this instance
+ * @return true until the callback is called
+ */
+bool SPIClass3W::isBusy()
+{
+	return (mAsyncActive == this);
+}
+
+/*!
+ * @brief Service request of the receive FIFO, called by the USICx_5_IRQHandler
+ */
+void SPIClass3W::handleInterrupt()
+{
+	if (mAsyncActive != NULL)
+	{
+		mAsyncActive->asyncReceive();
+	}
+}
+
+/*!
+ * @brief Selects the sensor and puts the words of the actual command into the transmit FIFO
+ */
+void SPIClass3W::asyncCommand()
+{
+	SPIC::Command_t &command = mAsyncCommands[mAsyncIndex];
 	//send via TX
-	XMC_GPIO_Init(m3Wire.miso.port, m3Wire.miso.pin, &m3Wire.miso_close);
 	XMC_GPIO_Init(m3Wire.mosi.port, m3Wire.mosi.pin, &m3Wire.mosi_open);
+	if (mAsyncIndex > 0)
+	{
+		delayMicroseconds(SPI3W_CS_OFF_US);
+	}
+	mAsyncReceiving = false;
+	XMC_USIC_CH_RXFIFO_SetSizeTriggerLimit(m3Wire.channel, XMC_USIC_CH_FIFO_SIZE_16WORDS, command.sentSize - 1U);
 	XMC_GPIO_SetOutputLevel(m3Wire.cs.port, m3Wire.cs.pin,XMC_GPIO_OUTPUT_LEVEL_LOW);
+	for(uint16_t data_index = 0; data_index < command.sentSize; data_index++)
+	{
+		XMC_USIC_CH_TXFIFO_PutData(m3Wire.channel, command.sent[data_index]);
+	}
+}
 
-	for(data_index = 0; data_index < size_of_sent_data; data_index++)
+/*!
+ * @brief Reads the receive FIFO after the command or after the response and goes on
+ * with the response, the next command or the end of the transfer
+ */
+void SPIClass3W::asyncReceive()
+{
+	SPIC::Command_t &command = mAsyncCommands[mAsyncIndex];
+	XMC_USIC_CH_RXFIFO_ClearEvent(m3Wire.channel, XMC_USIC_CH_RXFIFO_EVENT_STANDARD | XMC_USIC_CH_RXFIFO_EVENT_ALTERNATE);
+	if (!mAsyncReceiving)
 	{
-		XMC_SPI_CH_Transmit(m3Wire.channel, sent_data[data_index], XMC_SPI_CH_MODE_STANDARD);
-		while((XMC_SPI_CH_GetStatusFlag(m3Wire.channel) & XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION) == 0U);
-		XMC_SPI_CH_ClearStatusFlag(m3Wire.channel, XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION);
-		while (XMC_USIC_CH_GetReceiveBufferStatus(m3Wire.channel) == 0U);
-		received_data[0] = XMC_SPI_CH_GetReceivedData(m3Wire.channel);
+		while (!XMC_USIC_CH_RXFIFO_IsEmpty(m3Wire.channel))
+		{
+			command.received[0] = XMC_USIC_CH_RXFIFO_GetData(m3Wire.channel);
+		}
+
+		// receive via RX
+		XMC_GPIO_Init(m3Wire.mosi.port, m3Wire.mosi.pin, &m3Wire.mosi_close);
+		delayMicroseconds(SPI3W_TURNAROUND_US);
+		mAsyncReceiving = true;
+		XMC_USIC_CH_RXFIFO_SetSizeTriggerLimit(m3Wire.channel, XMC_USIC_CH_FIFO_SIZE_16WORDS, command.receivedSize - 1U);
+		for(uint16_t data_index = 0; data_index < command.receivedSize; data_index++)
+		{
+			XMC_USIC_CH_TXFIFO_PutData(m3Wire.channel, 0x0000);
+		}
+		return;
 	}
+	for(uint16_t data_index = 0; data_index < command.receivedSize; data_index++)
+	{
+		command.received[data_index] = XMC_USIC_CH_RXFIFO_GetData(m3Wire.channel);
+		if ((command.crc != NULL) && (data_index + 1 < command.receivedSize))
+		{
+			crcUpdateWord(*command.crc, command.received[data_index]);
+		}
+	}
+	XMC_GPIO_SetOutputLevel(m3Wire.cs.port, m3Wire.cs.pin,XMC_GPIO_OUTPUT_LEVEL_HIGH);
 
-	// receive via RX
-	XMC_GPIO_Init(m3Wire.miso.port, m3Wire.miso.pin, &m3Wire.miso_open);
-	XMC_GPIO_Init(m3Wire.mosi.port, m3Wire.mosi.pin, &m3Wire.mosi_close);
-	delayMicroseconds(5);
+	mAsyncIndex++;
+	if (mAsyncIndex < mAsyncCount)
+	{
+		asyncCommand();
+		return;
+	}
 
-	for(data_index = 0; data_index < size_of_received_data; data_index++)
+	// back to the polled transfers of sendReceiveList
+	XMC_USIC_CH_RXFIFO_DisableEvent(m3Wire.channel, XMC_USIC_CH_RXFIFO_EVENT_CONF_STANDARD | XMC_USIC_CH_RXFIFO_EVENT_CONF_ALTERNATE);
+	NVIC_DisableIRQ(asyncIrq());
+	XMC_USIC_CH_TXFIFO_Configure(m3Wire.channel, SPI3W_XMC_FIFO_TX, XMC_USIC_CH_FIFO_DISABLED, 0U);
+	XMC_USIC_CH_RXFIFO_Configure(m3Wire.channel, SPI3W_XMC_FIFO_RX, XMC_USIC_CH_FIFO_DISABLED, 0U);
+	SPIC::Callback_t callback = mAsyncCallback;
+	void *context = mAsyncContext;
+	mAsyncActive = NULL;
+	if (callback != NULL)
 	{
-		XMC_SPI_CH_Transmit(m3Wire.channel, 0x0000, XMC_SPI_CH_MODE_STANDARD);
-		while((XMC_SPI_CH_GetStatusFlag(m3Wire.channel) & XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION) == 0U);
-		XMC_SPI_CH_ClearStatusFlag(m3Wire.channel, XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION);
-		while (XMC_USIC_CH_GetReceiveBufferStatus(m3Wire.channel) == 0U);
-		received_data[data_index] = XMC_SPI_CH_GetReceivedData(m3Wire.channel);
+		callback(SPIC::OK, context);
 	}
+}
 
-	XMC_GPIO_SetOutputLevel(m3Wire.cs.port, m3Wire.cs.pin,XMC_GPIO_OUTPUT_LEVEL_HIGH);
+/*!
+ * @brief Interrupt of the service request SPI3W_XMC_SR of the USIC module of the channel
+ * @return interrupt number
+ */
+IRQn_Type SPIClass3W::asyncIrq()
+{
+	#if defined(USIC2)
+		if ((m3Wire.channel == XMC_USIC2_CH0) || (m3Wire.channel == XMC_USIC2_CH1))
+		{
+			return (USIC2_5_IRQn);
+		}
+	#endif
+	#if defined(USIC1)
+		if ((m3Wire.channel == XMC_USIC1_CH0) || (m3Wire.channel == XMC_USIC1_CH1))
+		{
+			return (USIC1_5_IRQn);
+		}
+	#endif
+	return (USIC0_5_IRQn);
+}
+
+extern "C" void USIC0_5_IRQHandler(void)
+{
+	SPIClass3W::handleInterrupt();
 }
 
+#if defined(USIC1)
+extern "C" void USIC1_5_IRQHandler(void)
+{
+	SPIClass3W::handleInterrupt();
+}
+#endif
+
+#if defined(USIC2)
+extern "C" void USIC2_5_IRQHandler(void)
+{
+	SPIClass3W::handleInterrupt();
+}
+#endif
+
+#endif /* TLE5012_XMC_ASYNC */
+
 /** @} */
 
 #endif /* SPI3W_INO */
@@ -8,6 +8,7 @@
  */
 
 #include "spic-arduino.hpp"
+#include "../../../corelib/tle5012b_crc.hpp"
 
 #if (TLE5012_FRAMEWORK == TLE5012_FRMWK_ARDUINO)
 
@@ -96,11 +97,43 @@ SPICIno::Error_t SPICIno::deinit()
  */
 SPICIno::Error_t SPICIno::triggerUpdate()
 {
+	Error_t err = triggerUpdateBegin();
+	if (err != OK)
+	{
+		return err;
+	}
+	//grace period for register snapshot
+	delayMicroseconds(5);
+	return (triggerUpdateEnd());
+}
+
+/**
+ * @brief
+ * First half of triggerUpdate, the snapshot is taken with CSQ going low.
+ * The caller keeps the grace period before triggerUpdateEnd.
+ *
+ * @return SPICIno::Error_t, INTF_ERROR while an async transfer runs on the port
+ */
+SPICIno::Error_t SPICIno::triggerUpdateBegin()
+{
+	if (isBusy())
+	{
+		return INTF_ERROR;
+	}
 	digitalWrite(this->sckPin, LOW);
 	digitalWrite(this->mosiPin, HIGH);
 	digitalWrite(this->csPin, LOW);
-	//grace period for register snapshot
-	delayMicroseconds(5);
+	return OK;
+}
+
+/**
+ * @brief
+ * Second half of triggerUpdate, releases CSQ
+ *
+ * @return SPICIno::Error_t
+ */
+SPICIno::Error_t SPICIno::triggerUpdateEnd()
+{
 	digitalWrite(this->csPin, HIGH);
 	return OK;
 }
@@ -111,14 +144,102 @@ SPICIno::Error_t SPICIno::triggerUpdate()
 * @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
 * @param received_data pointer to data structure buffer for the read data
 * @param size_of_received_data size of data words to be read
+* @return INTF_ERROR while an async transfer runs on the port, also for the other transfers
 */
 SPICIno::Error_t SPICIno::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
 {
+	if (isBusy())
+	{
+		return INTF_ERROR;
+	}
 	this->spi->setCSPin(this->csPin);
 	this->spi->sendReceiveSpi(sent_data,size_of_sent_data,received_data,size_of_received_data);
 	return OK;
 }
 
+/*!
+* Same as sendReceive, but folds the command and each received data word into
+* the safety word CRC while the next word is received
+* @param sent_data pointer to the command word
+* @param size_of_sent_data the size of the command word
+* @param received_data pointer to data structure buffer for the read data
+* @param size_of_received_data size of data words to be read, including the safety word
+* @param crc CRC context of the command and the received data words
+*/
+SPICIno::Error_t SPICIno::sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc)
+{
+	if (isBusy())
+	{
+		return INTF_ERROR;
+	}
+	crcInit(crc, sent_data[0]);
+	this->spi->setCSPin(this->csPin);
+	this->spi->sendReceiveSpi(sent_data,size_of_sent_data,received_data,size_of_received_data,&crc);
+	return OK;
+}
+
+/*!
+* Runs a list of commands in one SPI transaction with one pin setup, see
+* SPIClass3W::sendReceiveList
+* @param commands commands in the order of the transfers
+* @param count number of commands
+*/
+SPICIno::Error_t SPICIno::sendReceiveList(Command_t *commands, uint8_t count)
+{
+	if (isBusy())
+	{
+		return INTF_ERROR;
+	}
+	for (uint8_t i = 0; i < count; i++)
+	{
+		if (commands[i].crc != NULL)
+		{
+			crcInit(*commands[i].crc, commands[i].sent[0]);
+		}
+	}
+	this->spi->setCSPin(this->csPin);
+	this->spi->sendReceiveList(commands,count);
+	return OK;
+}
+
+#if (SPI3W_INO == SPI3W_XMC) && (TLE5012_XMC_ASYNC == 1)
+/*!
+* Starts a list of commands on the USIC FIFOs, the callback is called in the
+* interrupt when all are done, see SPIClass3W::sendReceiveListAsync
+* @param commands commands in the order of the transfers
+* @param count number of commands
+* @param callback called when all commands are done, or NULL
+* @param context passed to the callback
+* @return OK if started, INTF_ERROR if an async transfer is still running or a command
+* does not fit the 16 word USIC FIFOs
+*/
+SPICIno::Error_t SPICIno::sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context)
+{
+	if (this->spi->isBusy())
+	{
+		return INTF_ERROR;
+	}
+	for (uint8_t i = 0; i < count; i++)
+	{
+		if (commands[i].crc != NULL)
+		{
+			crcInit(*commands[i].crc, commands[i].sent[0]);
+		}
+	}
+	this->spi->setCSPin(this->csPin);
+	return (this->spi->sendReceiveListAsync(commands,count,callback,context) ? OK : INTF_ERROR);
+}
+
+/*!
+* Checks for a running async transfer on the SPI port
+* @return true until the callback is called
+*/
+bool SPICIno::isBusy()
+{
+	return (this->spi->isBusy());
+}
+#endif
+
 /** @} */
 
 #endif /** TLE5012_FRAMEWORK **/
@@ -47,7 +47,15 @@ class SPICIno: virtual public SPIC
 		Error_t     init();
 		Error_t     deinit();
 		Error_t     triggerUpdate();
+		Error_t     triggerUpdateBegin();
+		Error_t     triggerUpdateEnd();
 		Error_t     sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc);
+		Error_t     sendReceiveList(Command_t *commands, uint8_t count);
+		#if (SPI3W_INO == SPI3W_XMC) && (TLE5012_XMC_ASYNC == 1)
+		Error_t     sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context);
+		bool        isBusy();
+		#endif
 
 };
 
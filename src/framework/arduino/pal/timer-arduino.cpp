@@ -0,0 +1,136 @@
+/**
+ * @file        timer-arduino.cpp
+ * @brief       Arduino Timer PAL
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "timer-arduino.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_ARDUINO)
+
+#include <Arduino.h>
+
+/**
+ * @brief Constructor of the Arduino Timer class
+ *
+ */
+TimerIno::TimerIno() : startMilli(0), startMicro(0)
+{
+}
+
+/**
+ * @brief Destructor of the Arduino Timer class
+ *
+ */
+TimerIno::~TimerIno()
+{
+}
+
+/**
+ * @brief Initialization of the Timer
+ *
+ * @return      TimerIno::Error_t
+ */
+TimerIno::Error_t TimerIno::init()
+{
+	startMilli = 0;
+	startMicro = 0;
+	return OK;
+}
+
+/**
+ * @brief Deinitialize the Timer
+ *
+ * @return      TimerIno::Error_t
+ */
+TimerIno::Error_t TimerIno::deinit()
+{
+	startMilli = 0;
+	startMicro = 0;
+	return OK;
+}
+
+/**
+ * @brief Start the timer
+ *
+ * @return      TimerIno::Error_t
+ */
+TimerIno::Error_t TimerIno::start()
+{
+	startMilli = millis();
+	startMicro = micros();
+	return OK;
+}
+
+/**
+ * @brief Calculate the elapsed time
+ *
+ * @param[in]   &elapsed                Address of a value where the elapsed time in ms should be stored
+ * @return      TimerIno::Error_t
+ */
+TimerIno::Error_t TimerIno::elapsed(uint32_t &elapsed)
+{
+	elapsed = millis() - startMilli;
+	return OK;
+}
+
+/**
+ * @brief Calculate the elapsed time in microseconds, wraps after about 71 minutes
+ *
+ * @param[in]   &elapsed                Address of a value where the elapsed time in us should be stored
+ * @return      TimerIno::Error_t
+ */
+TimerIno::Error_t TimerIno::elapsedMicro(uint32_t &elapsed)
+{
+	elapsed = micros() - startMicro;
+	return OK;
+}
+
+/**
+ * @brief Stop the timer
+ *
+ * @return      TimerIno::Error_t
+ */
+TimerIno::Error_t TimerIno::stop()
+{
+	startMilli = 0;
+	startMicro = 0;
+	return OK;
+}
+
+/**
+ * @brief Time delay
+ *
+ * @param[in]   timeout                 Delay time in milliseconds
+ * @return      TimerIno::Error_t
+ */
+TimerIno::Error_t TimerIno::delayMilli(uint32_t timeout)
+{
+	delay(timeout);
+	return OK;
+}
+
+/**
+ * @brief Time delay
+ *
+ * delayMicroseconds takes an unsigned int, 16 bit on AVR, and is only exact up
+ * to 16383 us there, so whole milliseconds are waited with delay.
+ *
+ * @param[in]   timeout                 Delay time in microseconds
+ * @return      TimerIno::Error_t
+ */
+TimerIno::Error_t TimerIno::delayMicro(uint32_t timeout)
+{
+	if (timeout >= 1000)
+	{
+		delay(timeout / 1000);
+		timeout %= 1000;
+	}
+	delayMicroseconds((unsigned int) timeout);
+	return OK;
+}
+
+#endif /** TLE5012_FRAMEWORK **/
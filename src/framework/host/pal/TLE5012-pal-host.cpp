@@ -0,0 +1,58 @@
+/**
+ * @file        TLE5012-pal-host.cpp
+ * @brief       TLE5012 Host Hardware Platform
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "TLE5012-pal-host.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+/**
+ * @addtogroup hostPal
+ */
+
+/**
+ * Construct a new Tle5012Host::Tle5012Host object with one simulated sensor
+ */
+Tle5012Host::Tle5012Host():Tle5012b(), bus(sim), supply(&sim, GPIOHost::POSITIVE)
+{
+	Tle5012b::mSlave = TLE5012B_S0;
+	Tle5012b::sBus = &bus;
+}
+
+/**
+ * @brief Construct a new Tle5012Host::Tle5012Host object with sensor slave
+ *
+ * @param slave    sensor slave setting
+ */
+Tle5012Host::Tle5012Host(slaveNum slave):Tle5012b(), bus(sim), supply(&sim, GPIOHost::POSITIVE)
+{
+	Tle5012b::mSlave = slave;
+	Tle5012b::sBus = &bus;
+}
+
+/**
+ * @brief begin method, powers the simulated sensor on
+ * and sets the slave number.
+ *
+ * @return errorTypes
+ */
+errorTypes Tle5012Host::begin(void)
+{
+	// init helper libs
+	sBus->init();
+	supply.init();
+	Tle5012b::en = &supply;
+	// start sensor
+	enableSensor();
+	writeSlaveNumber(Tle5012b::mSlave);
+	// initial CRC check, should be = 0
+	return (readBlockCRC());
+}
+
+#endif /** TLE5012_FRAMEWORK **/
+/** @} */
@@ -0,0 +1,62 @@
+/*!
+ * \file        TLE5012-pal-host.hpp
+ * \name        TLE5012-pal-host.hpp - Host Hardware Abstraction Layer
+ * \author      Infineon Technologies AG
+ * \copyright   2026 Infineon Technologies AG
+ * \version     3.1.0
+ * \ref         hostPal
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012_PAL_HOST_HPP_
+#define TLE5012_PAL_HOST_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+/**
+ * @addtogroup hostPal
+ *
+ * @{
+ */
+
+#include "../../../corelib/TLE5012b.hpp"
+#include "../sim/tle5012-sim.hpp"
+#include "gpio-host.hpp"
+#include "timer-host.hpp"
+#include "spic-host.hpp"
+
+/**
+ * @brief represents a TLE5012b on a Linux/macOS host.
+ *
+ * The sensor is the software model Tle5012Sim behind a SPICHost bus, powered
+ * by a GPIOHost supply pin like the Sensor2go kit. Set the magnet trajectory
+ * on sim and use all Tle5012b functions as on a target.
+ *
+ * @see Tle5012b
+ */
+
+class Tle5012Host: virtual public Tle5012b
+{
+
+	public:
+
+		Tle5012Sim  sim;              //!< Simulated sensor
+		SPICHost    bus;              //!< SSC bus to the simulated sensor
+		GPIOHost    supply;           //!< Supply pin of the simulated sensor
+
+					Tle5012Host();
+					Tle5012Host(slaveNum slave);
+		errorTypes  begin();
+
+};
+
+/**
+ * @}
+ */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** TLE5012_PAL_HOST_HPP_ **/
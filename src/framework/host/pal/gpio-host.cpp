@@ -0,0 +1,124 @@
+/**
+ * @file        gpio-host.cpp
+ * @brief       Host PAL for the GPIO
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stddef.h>
+#include "gpio-host.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+/**
+ * @brief Constructor of the host GPIO class
+ *
+ */
+GPIOHost::GPIOHost() : supply(NULL), level(GPIO_LOW), mode(0), logic(POSITIVE)
+{
+}
+
+/**
+ * @brief Constructor of the host GPIO class
+ *
+ * @param[in]   supply  simulated sensor powered by this pin or NULL
+ * @param[in]   logic   Defines the logic level of the pin
+ */
+GPIOHost::GPIOHost(Tle5012Sim *supply, VLogic_t logic): supply(supply), level(GPIO_LOW), mode(0), logic(logic)
+{
+}
+
+/**
+ * @brief Destructor of the host GPIO class
+ *
+ */
+GPIOHost::~GPIOHost()
+{
+}
+
+/**
+ * @brief Initialize the GPIO
+ *
+ * @return      GPIOHost::Error_t
+ */
+GPIOHost::Error_t GPIOHost::init()
+{
+	return OK;
+}
+
+/**
+ * @brief Changes the GPIO mode
+ *
+ * @return      GPIOHost::Error_t
+ */
+GPIOHost::Error_t GPIOHost::changeMode(uint8_t mode)
+{
+	this->mode = mode;
+	return OK;
+}
+
+/**
+ * @brief Deinitialize the GPIO
+ *
+ * @return      GPIOHost::Error_t
+ */
+GPIOHost::Error_t GPIOHost::deinit()
+{
+	return OK;
+}
+
+/**
+ * @brief Read GPIO logic level
+ *
+ * @return      GPIOHost::VLevel_t
+ * @retval      0    = GPIO_LOW
+ * @retval      1    = GPIO_HIGH
+ */
+GPIOHost::VLevel_t GPIOHost::read()
+{
+	return level;
+}
+
+/**
+ * @brief Set GPIO logic level
+ *
+ * A rising supply of the simulated sensor is a power on reset.
+ *
+ * @param[in]   level   Desired logic level of the pin
+ * @return      GPIOHost::Error_t
+ */
+GPIOHost::Error_t GPIOHost::write(VLevel_t level)
+{
+	bool powerOn = (this->logic == POSITIVE) ? (level == GPIO_HIGH) : (level == GPIO_LOW);
+	bool wasOn = (this->logic == POSITIVE) ? (this->level == GPIO_HIGH) : (this->level == GPIO_LOW);
+	this->level = level;
+	if ((supply != NULL) && powerOn && !wasOn)
+	{
+		supply->reset();
+	}
+	return OK;
+}
+
+/**
+ * @brief Enable the GPIO
+ *
+ * @return      GPIOHost::Error_t
+ */
+GPIOHost::Error_t GPIOHost::enable()
+{
+	return write((this->logic == POSITIVE) ? GPIO_HIGH : GPIO_LOW);
+}
+
+/**
+ * @brief Disable the GPIO
+ *
+ * @return      GPIOHost::Error_t
+ */
+GPIOHost::Error_t GPIOHost::disable()
+{
+	return write((this->logic == POSITIVE) ? GPIO_LOW : GPIO_HIGH);
+}
+
+#endif /** TLE5012_FRAMEWORK **/
@@ -0,0 +1,56 @@
+/**
+ * @file        gpio-host.hpp
+ * @brief       Host PAL for the GPIO
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+
+#ifndef GPIO_HOST_HPP_
+#define GPIO_HOST_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+#include "../../../pal/gpio.hpp"
+#include "../sim/tle5012-sim.hpp"
+
+/**
+ * @addtogroup hostPal
+ * @{
+ */
+
+
+/**
+ * @brief Host GPIO class, keeps the level in memory. Used as sensor
+ * supply pin, like the EN pin of the Sensor2go kit, it powers the
+ * simulated sensor on and off.
+ *
+ */
+class GPIOHost: virtual public GPIO
+{
+	private:
+		Tle5012Sim  *supply;
+		VLevel_t    level;
+		uint8_t     mode;
+		VLogic_t    logic;
+
+	public:
+				GPIOHost();
+				GPIOHost(Tle5012Sim *supply, VLogic_t logic);
+				~GPIOHost();
+	Error_t     init();
+	Error_t     changeMode(uint8_t mode);
+	Error_t     deinit();
+	VLevel_t    read();
+	Error_t     write(VLevel_t level);
+	Error_t     enable();
+	Error_t     disable();
+};
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** GPIO_HOST_HPP_ **/
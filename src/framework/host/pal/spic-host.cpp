@@ -0,0 +1,268 @@
+/**
+ * @file        spic-host.cpp
+ * @brief       Host PAL for the SPI cover
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "spic-host.hpp"
+#include "../../../corelib/tle5012b_crc.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+/**
+ * @brief Constructor of the host SPIC class
+ *
+ * @param sim      simulated sensor on the chip select of this bus
+ */
+SPICHost::SPICHost(Tle5012Sim &sim)
+{
+	this->sim = &sim;
+	setupTime = 0;
+	pinTime = 0;
+	turnTime = SPIC_HOST_TURNAROUND_US * 1000;
+	realTime = false;
+	stopping = false;
+	queued = false;
+	busy = 0;
+	jobCommands = NULL;
+	jobCount = 0;
+	jobCallback = NULL;
+	jobContext = NULL;
+}
+
+/**
+ * @brief Destructor of the host SPIC class
+ *
+ */
+SPICHost::~SPICHost()
+{
+	stopWorker();
+	deinit();
+}
+
+/**
+ * @brief Initialize the SPIC
+ *
+ * @return      SPICHost::Error_t
+ */
+SPICHost::Error_t SPICHost::init()
+{
+	return OK;
+}
+
+/**
+ * @brief Deinitialize the SPIC
+ *
+ * @return      SPICHost::Error_t
+ */
+SPICHost::Error_t SPICHost::deinit()
+{
+	return OK;
+}
+
+/**
+ * @brief
+ * Triggers an update in the register buffer. The chip select pulse
+ * without clocks takes the snapshot of the UPD registers in the model,
+ * then CSQ is held for the grace period like on the Arduino.
+ *
+ * @return SPICHost::Error_t
+ */
+SPICHost::Error_t SPICHost::triggerUpdate()
+{
+	triggerUpdateBegin();
+	sim->advance(SPIC_HOST_TRIGGER_US * 1000);
+	return (triggerUpdateEnd());
+}
+
+/**
+ * @brief
+ * First half of triggerUpdate, sets the pins and takes the snapshot with
+ * CSQ going low. The caller keeps the grace period before triggerUpdateEnd.
+ *
+ * @return SPICHost::Error_t
+ */
+SPICHost::Error_t SPICHost::triggerUpdateBegin()
+{
+	sim->advance(pinTime);
+	sim->triggerUpdate();
+	return OK;
+}
+
+/**
+ * @brief
+ * Second half of triggerUpdate, releases CSQ
+ *
+ * @return SPICHost::Error_t
+ */
+SPICHost::Error_t SPICHost::triggerUpdateEnd()
+{
+	return OK;
+}
+
+/*!
+* Main SPI three wire communication functions for sending and receiving data
+* @param sent_data pointer two 2*unit16_t value for one command word and one data word if something should be written
+* @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
+* @param received_data pointer to data structure buffer for the read data
+* @param size_of_received_data size of data words to be read
+*/
+SPICHost::Error_t SPICHost::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	Command_t command = { sent_data, size_of_sent_data, received_data, size_of_received_data, NULL };
+	return (sendReceiveList(&command, 1));
+}
+
+/*!
+* Same as sendReceive, but folds the command and each received data word into
+* the safety word CRC right after it is received
+* @param sent_data pointer to the command word
+* @param size_of_sent_data the size of the command word
+* @param received_data pointer to data structure buffer for the read data
+* @param size_of_received_data size of data words to be read, including the safety word
+* @param crc CRC context of the command and the received data words
+*/
+SPICHost::Error_t SPICHost::sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc)
+{
+	Command_t command = { sent_data, size_of_sent_data, received_data, size_of_received_data, &crc };
+	return (sendReceiveList(&command, 1));
+}
+
+/*!
+* Runs a list of commands with one bus setup, each command in its own chip
+* select cycle
+* @param commands commands in the order of the transfers
+* @param count number of commands
+*/
+SPICHost::Error_t SPICHost::sendReceiveList(Command_t *commands, uint8_t count)
+{
+	std::chrono::steady_clock::time_point wall = std::chrono::steady_clock::now();
+	uint64_t start = sim->now();
+	sim->advance(setupTime);
+	for (uint8_t c = 0; c < count; c++)
+	{
+		Command_t &command = commands[c];
+		if (command.crc != NULL)
+		{
+			crcInit(*command.crc, command.sent[0]);
+		}
+		sim->advance(pinTime);
+		sim->select(true);
+		for (uint16_t i = 0; i < command.sentSize; i++)
+		{
+			sim->writeWord(command.sent[i]);
+		}
+		sim->advance(pinTime + turnTime);
+		for (uint16_t i = 0; i < command.receivedSize; i++)
+		{
+			command.received[i] = sim->readWord();
+			if ((command.crc != NULL) && (i + 1 < command.receivedSize))
+			{
+				crcUpdateWord(*command.crc, command.received[i]);
+			}
+		}
+		sim->select(false);
+	}
+	if (realTime)
+	{
+		wall += std::chrono::nanoseconds(sim->now() - start);
+		while (std::chrono::steady_clock::now() < wall)
+		{
+		}
+	}
+	return OK;
+}
+
+/*!
+* Hands the commands to the worker thread, or runs them at once without one
+* @param commands commands in the order of the transfers, valid until the callback
+* @param count number of commands
+* @param callback called on the worker thread when the commands are done
+* @param context passed to the callback
+* @return INTF_ERROR if a transfer is still running
+*/
+SPICHost::Error_t SPICHost::sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context)
+{
+	if (!worker.joinable())
+	{
+		return (SPIC::sendReceiveAsync(commands, count, callback, context));
+	}
+	if (__atomic_exchange_n(&busy, 1, __ATOMIC_ACQ_REL) != 0)
+	{
+		return INTF_ERROR;
+	}
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		jobCommands = commands;
+		jobCount = count;
+		jobCallback = callback;
+		jobContext = context;
+		queued = true;
+	}
+	wake.notify_one();
+	return OK;
+}
+
+bool SPICHost::isBusy()
+{
+	return (__atomic_load_n(&busy, __ATOMIC_ACQUIRE) != 0);
+}
+
+void SPICHost::startWorker()
+{
+	if (worker.joinable())
+	{
+		return;
+	}
+	stopping = false;
+	worker = std::thread(&SPICHost::work, this);
+}
+
+void SPICHost::stopWorker()
+{
+	if (!worker.joinable())
+	{
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+	}
+	wake.notify_one();
+	worker.join();
+}
+
+/*!
+* Runs one transfer after the other. busy is cleared before the callback, so
+* the callback can start the next transfer.
+*/
+void SPICHost::work()
+{
+	std::unique_lock<std::mutex> guard(lock);
+	while (true)
+	{
+		wake.wait(guard, [this] { return (queued || stopping); });
+		if (!queued)
+		{
+			return;
+		}
+		queued = false;
+		Command_t *commands = jobCommands;
+		uint8_t count = jobCount;
+		Callback_t callback = jobCallback;
+		void *context = jobContext;
+		guard.unlock();
+		Error_t status = sendReceiveList(commands, count);
+		__atomic_store_n(&busy, 0, __ATOMIC_RELEASE);
+		if (callback != NULL)
+		{
+			callback(status, context);
+		}
+		guard.lock();
+	}
+}
+
+#endif /** TLE5012_FRAMEWORK **/
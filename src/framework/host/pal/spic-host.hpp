@@ -0,0 +1,106 @@
+/**
+ * @file        spic-host.hpp
+ * @brief       Host PAL for the SPI cover
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+
+#ifndef SPIC_HOST_HPP_
+#define SPIC_HOST_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "../../../pal/spic.hpp"
+#include "../sim/tle5012-sim.hpp"
+
+/**
+ * @addtogroup hostPal
+ * @{
+ */
+
+#define SPIC_HOST_TURNAROUND_US    5    //!< default turnTime, SPI3W_TURNAROUND_US of the Arduino SPIClass3W
+#define SPIC_HOST_TRIGGER_US       5    //!< grace period of triggerUpdate, as held by SPICIno
+
+
+/**
+ * @brief Host SPIC class, the 3wire SSC bus to a simulated sensor
+ *
+ * The host side costs of a transfer, the bus setup, the pin direction
+ * changes and the turnaround wait of the 3wire interface, advance the model
+ * time like on a microcontroller. The turnaround wait is SPIC_HOST_TURNAROUND_US
+ * by default like on the Arduino, the others are 0. The setup is paid once per
+ * sendReceiveList, apart from the MOSI changes and the wait of each command.
+ * The update trigger sets the pins and holds CSQ low for the grace period.
+ *
+ * With startWorker the asynchronous transfers run on a worker thread like on
+ * a DMA or interrupt driven bus, without it they run synchronously. With
+ * realTime each transfer also takes its model time on the wall clock, so a
+ * host program can measure what overlapping the bus with computation gains.
+ * Only one thread may use the simulated sensor at a time.
+ */
+class SPICHost: virtual public SPIC
+{
+	private:
+		Tle5012Sim        *sim;
+
+	public:
+
+		uint32_t    setupTime;       //!< \brief ns per bus transaction, e.g. beginTransaction and the MISO setup
+		uint32_t    pinTime;         //!< \brief ns per MOSI direction change, two per command
+		uint32_t    turnTime;        //!< \brief ns of the wait from the command to the response
+		bool        realTime;        //!< \brief spin the model time of each transfer on the wall clock
+
+		SPICHost(Tle5012Sim &sim);
+		~SPICHost();
+		Error_t     init();
+		Error_t     deinit();
+		Error_t     triggerUpdate();
+		Error_t     triggerUpdateBegin();
+		Error_t     triggerUpdateEnd();
+		Error_t     sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc);
+		Error_t     sendReceiveList(Command_t *commands, uint8_t count);
+		Error_t     sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context);
+		bool        isBusy();
+
+		/**
+		 * @brief Starts the worker thread of the asynchronous transfers
+		 */
+		void        startWorker();
+
+		/**
+		 * @brief Stops the worker thread after the running transfer
+		 */
+		void        stopWorker();
+
+	private:
+
+		std::thread              worker;
+		std::mutex               lock;
+		std::condition_variable  wake;
+		bool                     stopping;
+		bool                     queued;     //!< \brief a transfer waits for the worker
+		uint8_t                  busy;       //!< \brief a transfer is queued or running
+		Command_t               *jobCommands;
+		uint8_t                  jobCount;
+		Callback_t               jobCallback;
+		void                    *jobContext;
+
+		/**
+		 * @brief Loop of the worker thread
+		 */
+		void        work();
+};
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** SPIC_HOST_HPP_ **/
@@ -0,0 +1,163 @@
+/**
+ * @file        timer-host.cpp
+ * @brief       Host Timer Platform Abstraction Layer
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "timer-host.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+#include <time.h>
+
+/**
+ * @brief Constructor of the host Timer class on the monotonic clock
+ *
+ */
+TimerHost::TimerHost(): clock(NULL), startTime(0)
+{
+}
+
+/**
+ * @brief Constructor of the host Timer class on the model time
+ *
+ * @param[in]   clock   simulated sensor
+ */
+TimerHost::TimerHost(Tle5012Sim *clock): clock(clock), startTime(0)
+{
+}
+
+/**
+ * @brief Destructor of the host Timer class
+ *
+ */
+TimerHost::~TimerHost()
+{
+}
+
+/**
+ * @brief Actual time in nanoseconds
+ */
+uint64_t TimerHost::nowNanos()
+{
+	if (clock != NULL)
+	{
+		return clock->now();
+	}
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief Waits or advances the model time
+ */
+void TimerHost::delayNanos(uint64_t ns)
+{
+	if (clock != NULL)
+	{
+		clock->advance(ns);
+		return;
+	}
+	struct timespec ts;
+	ts.tv_sec = (time_t) (ns / 1000000000ULL);
+	ts.tv_nsec = (long) (ns % 1000000000ULL);
+	nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief Initialization of the Timer
+ *
+ * @return      TimerHost::Error_t
+ */
+TimerHost::Error_t TimerHost::init()
+{
+	startTime = 0;
+	return OK;
+}
+
+/**
+ * @brief Deinitialize the Timer
+ *
+ * @return      TimerHost::Error_t
+ */
+TimerHost::Error_t TimerHost::deinit()
+{
+	startTime = 0;
+	return OK;
+}
+
+/**
+ * @brief Start the timer
+ *
+ * @return      TimerHost::Error_t
+ */
+TimerHost::Error_t TimerHost::start()
+{
+	startTime = nowNanos();
+	return OK;
+}
+
+/**
+ * @brief Calculate the elapsed time
+ *
+ * @param[in]   &elapsed                Address of a value where the elapsed time in ms should be stored
+ * @return      TimerHost::Error_t
+ */
+TimerHost::Error_t TimerHost::elapsed(uint32_t &elapsed)
+{
+	elapsed = (uint32_t) ((nowNanos() - startTime) / 1000000ULL);
+	return OK;
+}
+
+/**
+ * @brief Calculate the elapsed time in microseconds
+ *
+ * @param[in]   &elapsed                Address of a value where the elapsed time in us should be stored
+ * @return      TimerHost::Error_t
+ */
+TimerHost::Error_t TimerHost::elapsedMicro(uint32_t &elapsed)
+{
+	elapsed = (uint32_t) ((nowNanos() - startTime) / 1000ULL);
+	return OK;
+}
+
+/**
+ * @brief Stop the timer
+ *
+ * @return      TimerHost::Error_t
+ */
+TimerHost::Error_t TimerHost::stop()
+{
+	startTime = 0;
+	return OK;
+}
+
+/**
+ * @brief Time delay
+ *
+ * @param[in]   timeout                 Desired timeout in ms
+ * @return      TimerHost::Error_t
+ */
+TimerHost::Error_t TimerHost::delayMilli(uint32_t timeout)
+{
+	delayNanos((uint64_t) timeout * 1000000ULL);
+	return OK;
+}
+
+/**
+ * @brief Time delay
+ *
+ * @param[in]   timeout                 Desired timeout in us
+ * @return      TimerHost::Error_t
+ */
+TimerHost::Error_t TimerHost::delayMicro(uint32_t timeout)
+{
+	delayNanos((uint64_t) timeout * 1000ULL);
+	return OK;
+}
+
+#endif /** TLE5012_FRAMEWORK **/
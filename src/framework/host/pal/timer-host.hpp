@@ -0,0 +1,54 @@
+/**
+ * @file        timer-host.hpp
+ * @brief       Host Timer PAL
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef TIMER_HOST_HPP_
+#define TIMER_HOST_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+#include "../../../pal/timer.hpp"
+#include "../sim/tle5012-sim.hpp"
+
+/**
+ * @addtogroup hostPal
+ * @{
+ */
+
+/**
+ * @brief Host timer, runs on the monotonic clock or, with a simulated
+ * sensor given, on the model time so delays advance the model
+ */
+class TimerHost: virtual public Timer
+{
+	public:
+		TimerHost();
+		TimerHost(Tle5012Sim *clock);
+		~TimerHost();
+		Error_t init();
+		Error_t deinit();
+		Error_t start();
+		Error_t elapsed(uint32_t &elapsed);
+		Error_t elapsedMicro(uint32_t &elapsed);
+		Error_t stop();
+		Error_t delayMilli(uint32_t timeout);
+		Error_t delayMicro(uint32_t timeout);
+
+	private:
+		Tle5012Sim  *clock;
+		uint64_t    startTime;
+
+		uint64_t    nowNanos();
+		void        delayNanos(uint64_t ns);
+};
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** TIMER_HOST_HPP_ **/
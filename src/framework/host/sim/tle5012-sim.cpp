@@ -0,0 +1,481 @@
+/**
+ * @file        tle5012-sim.cpp
+ * @brief       Software model of the TLE5012B for the host framework
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "tle5012-sim.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+#include <math.h>
+#include <string.h>
+#include "../../../corelib/TLE5012b.hpp"
+
+/**
+ * @addtogroup hostPal
+ * @{
+ */
+
+#define SIM_NUM_ADDRESSES    64         /**< 6 bit register address */
+#define SIM_WRITE_LOCK       0x5000     /**< lock bits 14:11 = 1010b needed for the addresses 05h and above */
+#define SIM_LOCK_MASK        0x7800     /**< lock bits of the command word */
+#define SIM_LOCKED_ADDRESS   0x05       /**< first address which needs the lock */
+#define SIM_ADC_AMPLITUDE    3000.0     /**< ADC_X and ADC_Y amplitude of the model magnet */
+#define SIM_D_MAG            0x0177     /**< D_MAG of the model magnet */
+#define SIM_DEG_TO_RAD       0.017453292519943295    /**< pi / 180 */
+#define SIM_CRC_POLYNOMIAL   0x1D       /**< CRC8 SAE J1850 of the safety word and CRC_PAR */
+#define SIM_CRC_SEED         0xFF       /**< start value and final XOR of the CRC8 */
+
+/**
+ * @brief Writable bits by register address, from the register description
+ */
+static const uint16_t writeMask[SIM_NUM_ADDRESSES] = {
+	0x6000, 0x06FF, 0x0000, 0x0000, 0x7E00, 0x0000, 0xC017, 0xC47F,   // STAT - SIL
+	0x7FFF, 0xFFFF, 0xFFF0, 0xFFF0, 0xFFF0, 0xFFFF, 0xFFFB, 0xFFFF,   // MOD_2 - TCO_Y
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0x01FF, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0               // T25O
+};
+
+/**
+ * @brief Registers with an update buffer
+ */
+static const uint8_t updateRegisters[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15, 0x20 };
+
+/**
+ * @brief Update periods for FIR_MD in ns, as used for the speed calculation of the library
+ */
+static const uint32_t firPeriod[4] = { 21300, 42700, 85300, 170600 };
+
+/**
+ * @brief CRC8 step over one byte, bit by bit from the data sheet definition. The
+ * model keeps its own CRC, so it stays a reference for the CRC engine of the library.
+ * @param crc CRC register
+ * @param data next byte
+ * @return new CRC register
+ */
+static uint8_t simCrcByte(uint8_t crc, uint8_t data)
+{
+	crc ^= data;
+	for (uint8_t bit = 0; bit < 8; bit++)
+	{
+		crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ SIM_CRC_POLYNOMIAL) : (uint8_t) (crc << 1);
+	}
+	return (crc);
+}
+
+/**
+ * @brief CRC8 step over one 16 bit word, high byte first
+ */
+static uint8_t simCrcWord(uint8_t crc, uint16_t data)
+{
+	return (simCrcByte(simCrcByte(crc, (uint8_t) (data >> 8)), (uint8_t) data));
+}
+
+/**
+ * @brief RD status bits in the fresh mask
+ */
+enum freshBits
+{
+	FRESH_STAT = 0x01,
+	FRESH_AVAL = 0x04,
+	FRESH_ASPD = 0x08,
+	FRESH_AREV = 0x10
+};
+
+/**
+ * @brief Construct a new Tle5012Sim object, which starts with a power on reset
+ * and a magnet at rest at 0°
+ */
+Tle5012Sim::Tle5012Sim(): spiClock(SIM_SPI_CLOCK), csTime(500), transfers(0), words(0), frames(0),
+	time(0), clock(&time), frameStart(0), angle0(0.0), speed0(0.0), accel0(0.0), angleFunc(NULL), angleContext(NULL),
+	temperature(25.0), magnetInvalid(false), crcErrors(0), state(IDLE), command(0), address(0), remaining(0), crc(0)
+{
+	reset();
+}
+
+/**
+ * @brief Destroy the Tle5012Sim object
+ */
+Tle5012Sim::~Tle5012Sim()
+{
+}
+
+/**
+ * @brief Power on defaults of the registers, CRC_PAR fits the defaults
+ */
+void Tle5012Sim::defaults()
+{
+	memset(regs, 0, sizeof(regs));
+	memset(upd, 0, sizeof(upd));
+	regs[0x06] = 0x4001;    // MOD_1 FIR_MD 42.7 µs, IIF mode A/B
+	regs[0x08] = 0x0800;    // MOD_2 angle range 360°
+	regs[0x0D] = 0x0001;    // IFAB hysteresis
+	regs[0x0F] = (regs[0x0F] & 0xFF00) | crcPar();
+}
+
+/**
+ * @brief CRC over the registers 08 - 0F without CRC_PAR, as the sensor checks it
+ * @return expected CRC_PAR
+ */
+uint8_t Tle5012Sim::crcPar()
+{
+	// 08 - 0E and the first byte of 0F
+	uint8_t crcValue = SIM_CRC_SEED;
+	for (uint8_t i = 0x08; i < 0x0F; i++)
+	{
+		crcValue = simCrcWord(crcValue, regs[i]);
+	}
+	crcValue = simCrcByte(crcValue, (uint8_t) (regs[0x0F] >> 8));
+	return ((uint8_t) (crcValue ^ SIM_CRC_SEED));
+}
+
+void Tle5012Sim::reset()
+{
+	defaults();
+	resetFlag = true;
+	systemError = false;
+	accessError = false;
+	fresh = 0;
+	state = IDLE;
+	frameStart = *clock;
+	calculateFrame(frameStart);
+}
+
+void Tle5012Sim::setTrajectory(double angle, double speed, double accel)
+{
+	angle0 = angle;
+	speed0 = speed;
+	accel0 = accel;
+	angleFunc = NULL;
+	angleContext = NULL;
+}
+
+void Tle5012Sim::setTrajectory(angleFunc_t func, void *context)
+{
+	angleFunc = func;
+	angleContext = context;
+}
+
+void Tle5012Sim::setTemperature(double temperature)
+{
+	this->temperature = temperature;
+}
+
+double Tle5012Sim::angleAt(double time)
+{
+	if (angleFunc != NULL)
+	{
+		return (angleFunc(time, angleContext));
+	}
+	return (angle0 + (speed0 * time) + (0.5 * accel0 * time * time));
+}
+
+void Tle5012Sim::advance(uint64_t ns)
+{
+	*clock += ns;
+}
+
+uint64_t Tle5012Sim::now()
+{
+	return (*clock);
+}
+
+void Tle5012Sim::shareClock(Tle5012Sim &master)
+{
+	clock = master.clock;
+	frameStart = *clock;
+}
+
+uint32_t Tle5012Sim::updatePeriod()
+{
+	return (firPeriod[regs[0x06] >> 14]);
+}
+
+double Tle5012Sim::angleRangeFactor()
+{
+	return (((regs[0x08] & 0x7FF0) >> 4) / 128.0);
+}
+
+bool Tle5012Sim::isRegister(uint8_t address)
+{
+	return (Reg::posFromAddress((uint16_t) address << 4) < MAX_NUM_REG);
+}
+
+/**
+ * @brief Catches up with all update periods up to the actual time
+ */
+void Tle5012Sim::update()
+{
+	uint64_t period = updatePeriod();
+	if (*clock < frameStart + period)
+	{
+		return;
+	}
+	uint64_t passed = (*clock - frameStart) / period;
+	frames += passed;
+	frameStart += passed * period;
+	calculateFrame(frameStart);
+}
+
+/**
+ * @brief Calculates the angle values at the start of an update period
+ * @param start start of the update period in ns
+ */
+void Tle5012Sim::calculateFrame(uint64_t start)
+{
+	double t = start * 1e-9;
+	double period = updatePeriod() * 1e-9;
+	double direction = (regs[0x08] & 0x0008) ? -1.0 : 1.0;
+	double toRaw = angleRangeFactor() * 32768.0 / 360.0;
+	bool prediction = (regs[0x08] & 0x0004) != 0;
+	double angle = direction * angleAt(t);
+	double speedAngle = direction * angleAt(t - ((prediction ? 3 : 2) * period));
+
+	// prediction extrapolates the angle by one update period
+	double output = angle;
+	if (prediction)
+	{
+		output += angle - (direction * angleAt(t - period));
+	}
+	int32_t rawAngle = (int32_t) lround(output * toRaw);
+	int32_t rawSpeed = (int32_t) lround((angle - speedAngle) * toRaw);
+	rawSpeed = (rawSpeed > 16383) ? 16383 : ((rawSpeed < -16384) ? -16384 : rawSpeed);
+	// AREV counts at the wrap of the rounded AVAL from +180° to -180°
+	int32_t revolutions = (int32_t) floor((lround(angle * 32768.0 / 360.0) + 16384.0) / 32768.0);
+	int32_t rawTemp = (int32_t) lround((temperature * 2.776) - 152.0);
+
+	regs[0x02] = (uint16_t) (rawAngle & 0x7FFF);
+	regs[0x03] = (uint16_t) (rawSpeed & 0x7FFF);
+	regs[0x04] = (uint16_t) (((frames & 0x3F) << 9) | (revolutions & 0x1FF));
+	regs[0x05] = (uint16_t) (rawTemp & 0x1FF);
+	regs[0x10] = (uint16_t) (int16_t) lround(SIM_ADC_AMPLITUDE * cos(angle * SIM_DEG_TO_RAD));
+	regs[0x11] = (uint16_t) (int16_t) lround(SIM_ADC_AMPLITUDE * sin(angle * SIM_DEG_TO_RAD));
+	regs[0x14] = SIM_D_MAG;
+	regs[0x15] = (uint16_t) ((rawTemp + 0x200) & 0x3FF);
+	regs[0x20] = (uint16_t) (lround(angle * 4096.0 / 360.0) & 0x7FFF);
+	fresh |= FRESH_STAT | FRESH_AVAL | FRESH_ASPD | FRESH_AREV;
+}
+
+/**
+ * @brief Value of a register as shifted out, clears the RD status bits
+ * @param address register address
+ * @param buffered UPD bit of the command
+ * @return register value
+ */
+uint16_t Tle5012Sim::readRegister(uint8_t address, bool buffered)
+{
+	if (!isRegister(address))
+	{
+		return (0x0000);
+	}
+	if (buffered && (memchr(updateRegisters, address, sizeof(updateRegisters)) != NULL))
+	{
+		return (upd[address]);
+	}
+
+	uint16_t data = regs[address];
+	uint16_t freshBit = (uint16_t) (1U << address);
+	switch (address)
+	{
+		case 0x00:
+			// reading STAT releases the latched system error
+			systemError = false;
+			// fall through
+		case 0x02:
+		case 0x03:
+		case 0x04:
+			data |= (fresh & freshBit) ? 0x8000 : 0x0000;
+			fresh &= ~freshBit;
+			break;
+		case 0x05:
+			data |= (uint16_t) (((*clock - frameStart) * 128 / updatePeriod()) << 9);
+			break;
+		default:
+			break;
+	}
+	return (data);
+}
+
+/**
+ * @brief Writes the writable bits of a register, handles resets and the fuse reload
+ * @param address register address
+ * @param data written data
+ */
+void Tle5012Sim::writeRegister(uint8_t address, uint16_t data)
+{
+	regs[address] = (regs[address] & ~writeMask[address]) | (data & writeMask[address]);
+	if ((address == 0x01) && (data & ACSTAT_RESET_MASK))
+	{
+		uint16_t snr = regs[0x00] & 0x6000;
+		reset();
+		// the firmware reset keeps the slave number
+		if (!(data & 0x0001))
+		{
+			regs[0x00] |= snr;
+		}
+	}else if ((address == 0x07) && (data & SIL_FUSEREL_MASK))
+	{
+		uint16_t keep[SIM_NUM_ADDRESSES];
+		memcpy(keep, regs, sizeof(keep));
+		defaults();
+		// only the configuration registers are reloaded
+		for (uint8_t i = 0; i < SIM_NUM_ADDRESSES; i++)
+		{
+			if (((i < 0x06) || (i > 0x0F)) && (i != 0x30))
+			{
+				regs[i] = keep[i];
+			}
+		}
+	}
+}
+
+uint16_t Tle5012Sim::safetyWord()
+{
+	uint16_t data = 0;
+	if (resetFlag)
+	{
+		data |= CHIP_RESET_MASK;
+		resetFlag = false;
+	}
+	data |= systemError ? 0 : SYSTEM_ERROR_MASK;
+	data |= accessError ? 0 : INTERFACE_ERROR_MASK;
+	data |= magnetInvalid ? 0 : INV_ANGLE_ERROR_MASK;
+	// RESP has the bit of the slave number cleared
+	data |= (uint16_t) ((0xF & ~(1U << ((regs[0x00] >> 13) & 0x3))) << 8);
+	uint8_t crcValue = (uint8_t) (crc ^ SIM_CRC_SEED);
+	if (crcErrors > 0)
+	{
+		crcValue ^= 0x5A;
+		crcErrors--;
+	}
+	return (data | crcValue);
+}
+
+void Tle5012Sim::select(bool active)
+{
+	*clock += csTime / 2;
+	if (active)
+	{
+		transfers++;
+		accessError = false;
+		state = COMMAND;
+	}else{
+		state = IDLE;
+	}
+}
+
+void Tle5012Sim::writeWord(uint16_t data)
+{
+	words++;
+	*clock += 16000000000ULL / spiClock;
+	update();
+	switch (state)
+	{
+		case COMMAND:
+			command = data;
+			address = (uint8_t) ((data & REG_ADDRESS_MASK) >> 4);
+			remaining = (uint8_t) (data & 0x000F);
+			crc = simCrcWord(SIM_CRC_SEED, data);
+			if (data & READ_SENSOR)
+			{
+				accessError = !isRegister(address);
+				state = (remaining > 0) ? DATA_OUT : SAFETY;
+			}else{
+				accessError = !isRegister(address)
+					|| ((address >= SIM_LOCKED_ADDRESS) && ((data & SIM_LOCK_MASK) != SIM_WRITE_LOCK));
+				state = (remaining > 0) ? DATA_IN : SAFETY;
+			}
+			break;
+		case DATA_IN:
+			crc = simCrcWord(crc, data);
+			if (!accessError)
+			{
+				writeRegister(address, data);
+			}
+			address = (address + 1) & 0x3F;
+			remaining--;
+			state = (remaining > 0) ? DATA_IN : SAFETY;
+			break;
+		default:
+			break;
+	}
+}
+
+uint16_t Tle5012Sim::readWord()
+{
+	uint16_t data = 0;
+	words++;
+	update();
+	switch (state)
+	{
+		case DATA_OUT:
+			data = readRegister(address, (command & UPD_high) != 0);
+			crc = simCrcWord(crc, data);
+			address = (address + 1) & 0x3F;
+			remaining--;
+			state = (remaining > 0) ? DATA_OUT : SAFETY;
+			break;
+		case SAFETY:
+			data = safetyWord();
+			state = DONE;
+			break;
+		default:
+			break;
+	}
+	*clock += 16000000000ULL / spiClock;
+	return (data);
+}
+
+void Tle5012Sim::triggerUpdate()
+{
+	*clock += csTime;
+	update();
+	uint16_t freshBits = fresh;
+	bool error = systemError;
+	for (uint8_t i = 0; i < sizeof(updateRegisters); i++)
+	{
+		upd[updateRegisters[i]] = readRegister(updateRegisters[i], false);
+	}
+	fresh = freshBits;
+	systemError = error;
+}
+
+uint16_t Tle5012Sim::peek(uint8_t address)
+{
+	update();
+	return (regs[address & 0x3F]);
+}
+
+void Tle5012Sim::poke(uint8_t address, uint16_t data)
+{
+	regs[address & 0x3F] = data;
+}
+
+bool Tle5012Sim::isCrcParValid()
+{
+	return (crcPar() == (regs[0x0F] & 0x00FF));
+}
+
+void Tle5012Sim::injectCrcError(uint16_t count)
+{
+	crcErrors = count;
+}
+
+void Tle5012Sim::injectSystemError()
+{
+	systemError = true;
+}
+
+void Tle5012Sim::setMagnetInvalid(bool invalid)
+{
+	magnetInvalid = invalid;
+}
+
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
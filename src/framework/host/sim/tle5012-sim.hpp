@@ -0,0 +1,228 @@
+/**
+ * @file        tle5012-sim.hpp
+ * @brief       Software model of the TLE5012B for the host framework
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef TLE5012_SIM_HPP_
+#define TLE5012_SIM_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+#include <stdint.h>
+
+/**
+ * @addtogroup hostPal
+ * @{
+ */
+
+#define SIM_SPI_CLOCK        1000000U   /**< default SCK, SPEED of the Arduino SPIClass3W */
+
+/**
+ * @brief Model of a TLE5012B as SSC slave
+ *
+ * The model works word by word like the sensor: the command word is decoded
+ * after it is shifted in, every data word is taken from the register file
+ * when it is shifted out and the safety word carries the status bits, the
+ * RESP slave bits and the CRC over the command and all data words.
+ * Time only advances with the bus words, chip select cycles and advance(),
+ * so the results are deterministic.
+ *
+ * The angle values follow a magnet trajectory. They are calculated once per
+ * update period given by FIR_MD, so a burst read can see two frames like on
+ * the real sensor unless the UPD snapshot buffer is read. ASPD is the angle
+ * difference over 2 or, with prediction, 3 update periods, which is what
+ * Tle5012b::getAngleSpeed expects. FCNT counts the update periods and the
+ * FSYNC counter gives the position inside the actual period in 1/128 steps.
+ */
+class Tle5012Sim
+{
+	public:
+
+		/**
+		 * @brief Magnet angle in degree at a time in seconds, unwrapped, counter-clockwise positive
+		 */
+		typedef double (*angleFunc_t)(double time, void *context);
+
+		uint32_t  spiClock;          //!< \brief SCK frequency in Hz, sets the time of one 16 bit word, SIM_SPI_CLOCK by default
+		uint32_t  csTime;            //!< \brief chip select setup and hold time in ns per transfer
+		uint64_t  transfers;         //!< \brief chip select cycles
+		uint64_t  words;             //!< \brief 16 bit words on the bus
+		uint64_t  frames;            //!< \brief update periods calculated
+
+		Tle5012Sim();
+		~Tle5012Sim();
+
+		/**
+		 * @brief Hardware or power on reset, all registers get their default values
+		 * and the next safety word has STAT_RES set
+		 */
+		void        reset();
+
+		/**
+		 * @brief Magnet with constant acceleration
+		 * @param[in]   angle   start angle in degree
+		 * @param[in]   speed   angle speed in degree per second
+		 * @param[in]   accel   angle acceleration in degree per second²
+		 */
+		void        setTrajectory(double angle, double speed, double accel = 0.0);
+
+		/**
+		 * @brief Magnet following a user function
+		 * @param[in]   func    angle in degree at a time
+		 * @param[in]   context passed to func
+		 */
+		void        setTrajectory(angleFunc_t func, void *context);
+
+		/**
+		 * @brief Sets the die temperature
+		 * @param[in]   temperature in °C
+		 */
+		void        setTemperature(double temperature);
+
+		/**
+		 * @brief Magnet angle of the trajectory
+		 * @param[in]   time    in seconds
+		 * @return      angle in degree, unwrapped
+		 */
+		double      angleAt(double time);
+
+		/**
+		 * @brief Advances the model time
+		 * @param[in]   ns      time in nanoseconds
+		 */
+		void        advance(uint64_t ns);
+
+		/**
+		 * @brief Model time in nanoseconds since construction
+		 */
+		uint64_t    now();
+
+		/**
+		 * @brief Runs this model on the time of another one, like several
+		 * sensors on one bus. The update periods of this model start anew.
+		 * @param[in]   master  model which owns the time, must live longer
+		 */
+		void        shareClock(Tle5012Sim &master);
+
+		/**
+		 * @brief Update period set by FIR_MD in nanoseconds
+		 */
+		uint32_t    updatePeriod();
+
+		/**
+		 * @brief Chip select, starts or ends a transfer
+		 * @param[in]   active  true for CSQ low
+		 */
+		void        select(bool active);
+
+		/**
+		 * @brief Word shifted in from the master
+		 * @param[in]   data    command or data word
+		 */
+		void        writeWord(uint16_t data);
+
+		/**
+		 * @brief Word shifted out to the master
+		 * @return      data or safety word
+		 */
+		uint16_t    readWord();
+
+		/**
+		 * @brief CSQ pulse without clocks, takes the snapshot of the update registers
+		 */
+		void        triggerUpdate();
+
+		/**
+		 * @brief Register value without any bus access
+		 * @param[in]   address 6 bit register address
+		 * @return      register value
+		 */
+		uint16_t    peek(uint8_t address);
+
+		/**
+		 * @brief Sets a register without any bus access
+		 * @param[in]   address 6 bit register address
+		 * @param[in]   data    register value
+		 */
+		void        poke(uint8_t address, uint16_t data);
+
+		/**
+		 * @brief Checks CRC_PAR in TCO_Y against the registers 08 - 0F
+		 * @return      true if CRC_PAR fits
+		 */
+		bool        isCrcParValid();
+
+		/**
+		 * @brief Corrupts the CRC of the next safety words
+		 * @param[in]   count   number of safety words
+		 */
+		void        injectCrcError(uint16_t count);
+
+		/**
+		 * @brief Sets STAT_ERR in the safety words until STAT is read
+		 */
+		void        injectSystemError();
+
+		/**
+		 * @brief Sets STAT_ANG in the safety words as long as the magnet is invalid
+		 * @param[in]   invalid true for a missing or too weak magnet
+		 */
+		void        setMagnetInvalid(bool invalid);
+
+	private:
+
+		enum State_t
+		{
+			IDLE,       //!< \brief no transfer
+			COMMAND,    //!< \brief waiting for the command word
+			DATA_IN,    //!< \brief receiving write data
+			DATA_OUT,   //!< \brief sending read data
+			SAFETY,     //!< \brief sending the safety word
+			DONE        //!< \brief transfer finished, further words are 0
+		};
+
+		uint16_t    regs[64];        //!< \brief register file by address
+		uint16_t    upd[64];         //!< \brief update buffer of the volatile registers
+		uint16_t    fresh;           //!< \brief RD status bits of STAT, AVAL, ASPD and AREV
+		uint64_t    time;            //!< \brief model time in ns
+		uint64_t   *clock;           //!< \brief time of this model or of the shareClock master
+		uint64_t    frameStart;      //!< \brief start of the actual update period
+		double      angle0;          //!< \brief trajectory start angle
+		double      speed0;          //!< \brief trajectory speed
+		double      accel0;          //!< \brief trajectory acceleration
+		angleFunc_t angleFunc;       //!< \brief user trajectory or NULL
+		void       *angleContext;    //!< \brief context of the user trajectory
+		double      temperature;     //!< \brief die temperature in °C
+		bool        resetFlag;       //!< \brief STAT_RES of the next safety word
+		bool        systemError;     //!< \brief STAT_ERR latched until STAT is read
+		bool        accessError;     //!< \brief STAT_ACC of the actual transfer
+		bool        magnetInvalid;   //!< \brief STAT_ANG
+		uint16_t    crcErrors;       //!< \brief safety words to corrupt
+
+		State_t     state;
+		uint16_t    command;         //!< \brief actual command word
+		uint8_t     address;         //!< \brief next register address of the transfer
+		uint8_t     remaining;       //!< \brief data words left in the transfer
+		uint8_t     crc;             //!< \brief CRC8 context of the transfer
+
+		void        defaults();
+		uint8_t     crcPar();
+		void        update();
+		void        calculateFrame(uint64_t start);
+		uint16_t    readRegister(uint8_t address, bool buffered);
+		void        writeRegister(uint8_t address, uint16_t data);
+		uint16_t    safetyWord();
+		bool        isRegister(uint8_t address);
+		double      angleRangeFactor();
+};
+
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** TLE5012_SIM_HPP_ **/
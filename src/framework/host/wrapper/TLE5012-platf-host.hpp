@@ -0,0 +1,49 @@
+/**
+ * @file        TLE5012-platf-host.hpp
+ * @brief       TLE5012 Host Platform
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef TLE5012_PLATF_HOST_HPP_
+#define TLE5012_PLATF_HOST_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_HOST)
+
+/**
+ * @class Tle5012Host
+ *
+ * @brief represents the TLE5012 base class
+ *
+ * This class provides the TLE5012 API on a Linux/macOS host with a simulated
+ * sensor, so applications and the library itself can be run and measured
+ * without hardware.
+ *
+ * @addtogroup platfHost
+ * @{
+ */
+
+#include "../pal/TLE5012-pal-host.hpp"
+#include "../../../corelib/tle5012b_sampler.hpp"
+#include "../../../corelib/tle5012b_position.hpp"
+#include "../../../corelib/tle5012b_estimator.hpp"
+#include "../../../corelib/tle5012b_predictor.hpp"
+#include "../../../corelib/tle5012b_foc.hpp"
+#include "../../../corelib/tle5012b_async.hpp"
+#include "../../../corelib/tle5012b_bus.hpp"
+#include <stdio.h>
+
+// Support macros
+//!< \brief Prints a binary number with leading zeros (Automatic Handling)
+#define PRINTBIN(Num) for (uint32_t t = (1UL << ((sizeof(Num)*8)-1)); t; t >>= 1) putchar(Num  & t ? '1' : '0');
+//!< \brief Prints a binary number with leading zeros (Automatic Handling) with space
+#define PRINTBINS(Num) for (uint32_t t = (1UL << ((sizeof(Num)*8)-1)); t; t >>= 1) printf(Num  & t ? " 1 " : " 0 ");
+
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** TLE5012_PLATF_HOST_HPP_ **/
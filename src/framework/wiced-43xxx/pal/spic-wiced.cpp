@@ -8,6 +8,7 @@
  */
 
 #include "spic-wiced.hpp"
+#include "../../../corelib/tle5012b_crc.hpp"
 
 #if (TLE5012_FRAMEWORK == TLE5012_FRMWK_WICED)
 #include "wiced_rtos.h"
@@ -186,4 +187,44 @@ SPICWiced::Error_t SPICWiced::sendReceive(uint16_t* sent_data, uint16_t size_of_
 	return OK;
 }
 
+/*!
+* Same as sendReceive, but folds the command and each received data word into
+* the safety word CRC right after it is received
+* @param sent_data pointer to the command word
+* @param size_of_sent_data the size of the command word
+* @param received_data pointer to data structure buffer for the read data
+* @param size_of_received_data size of data words to be read, including the safety word
+* @param crc CRC context of the command and the received data words
+*/
+SPICWiced::Error_t SPICWiced::sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc)
+{
+	uint32_t data_index = 0;
+	//send via TX
+
+	crcInit(crc, sent_data[0]);
+	wiced_gpio_init(this->misoPin, INPUT_HIGH_IMPEDANCE);
+	wiced_gpio_init(this->mosiPin, OUTPUT_PUSH_PULL);
+	wiced_gpio_output_low(this->csPin);
+	for(data_index = 0; data_index < size_of_sent_data; data_index++)
+	{
+		transfer16(sent_data[data_index],received_data[0]);
+	}
+
+	// For timing reasons we use only one gpio change
+	wiced_gpio_init(this->mosiPin, INPUT_HIGH_IMPEDANCE);
+	wiced_rtos_delay_microseconds( 5 );
+
+	for(data_index = 0; data_index < size_of_received_data; data_index++)
+	{
+		transfer16(0x0000,received_data[data_index]);
+		if (data_index + 1 < size_of_received_data)
+		{
+			crcUpdateWord(crc, received_data[data_index]);
+		}
+	}
+
+	wiced_gpio_output_high(this->csPin);
+	return OK;
+}
+
 #endif /** TLE5012_FRAMEWORK **/
@@ -61,6 +61,7 @@ class SPICWiced: virtual public SPIC
 		Error_t     transfer16(uint16_t send, uint16_t &received);
 		Error_t     triggerUpdate();
 		Error_t     sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc);
 
 };
 /** @} */
@@ -0,0 +1,28 @@
+/**
+ * @file        crc8-ctx.hpp
+ * @brief       CRC context of the safety word check shared by the PAL and the corelib
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CRC8_CTX_HPP_
+#define CRC8_CTX_HPP_
+
+#include <stdint.h>
+
+/**
+ * @addtogroup pal
+ * @{
+ */
+
+/**
+ * @brief CRC register of a running safety word check, see SPIC::sendReceiveCrc.
+ * The functions on it are in corelib/tle5012b_crc.hpp.
+ */
+typedef uint8_t crc8Ctx_t;
+
+/** @} */
+
+#endif /** CRC8_CTX_HPP_ **/
@@ -0,0 +1,180 @@
+/**
+ * @file        spic-queue.cpp
+ * @brief       Request queue for asynchronous transfers of the SPI cover
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "spic-queue.hpp"
+
+#if (TLE5012_SPIC_ASYNC == 1)
+
+#define QUEUE_MASK    (TLE5012_SPIC_QUEUE_DEPTH - 1)
+
+static_assert((TLE5012_SPIC_QUEUE_DEPTH >= 2) && (TLE5012_SPIC_QUEUE_DEPTH <= 128)
+	&& ((TLE5012_SPIC_QUEUE_DEPTH & QUEUE_MASK) == 0), "queue depth must be a power of two");
+
+/**
+ * @brief Constructor of the request queue
+ *
+ * @param bus      SPIC which does the transfers
+ */
+SPICQueue::SPICQueue(SPIC *bus)
+{
+	this->bus = bus;
+	submitted = 0;
+	rejected = 0;
+	head = 0;
+	tail = 0;
+	running = 0;
+	pumping = 0;
+}
+
+/**
+ * @brief Initializes the SPIC
+ *
+ * @return      SPICQueue::Error_t
+ */
+SPICQueue::Error_t SPICQueue::init()
+{
+	return (bus->init());
+}
+
+/**
+ * @brief Deinitializes the SPIC after the queued requests
+ *
+ * @return      SPICQueue::Error_t
+ */
+SPICQueue::Error_t SPICQueue::deinit()
+{
+	flush();
+	return (bus->deinit());
+}
+
+SPICQueue::Error_t SPICQueue::triggerUpdate()
+{
+	flush();
+	return (bus->triggerUpdate());
+}
+
+SPICQueue::Error_t SPICQueue::triggerUpdateBegin()
+{
+	flush();
+	return (bus->triggerUpdateBegin());
+}
+
+SPICQueue::Error_t SPICQueue::triggerUpdateEnd()
+{
+	return (bus->triggerUpdateEnd());
+}
+
+SPICQueue::Error_t SPICQueue::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	flush();
+	return (bus->sendReceive(sent_data, size_of_sent_data, received_data, size_of_received_data));
+}
+
+SPICQueue::Error_t SPICQueue::sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc)
+{
+	flush();
+	return (bus->sendReceiveCrc(sent_data, size_of_sent_data, received_data, size_of_received_data, crc));
+}
+
+SPICQueue::Error_t SPICQueue::sendReceiveList(Command_t *commands, uint8_t count)
+{
+	flush();
+	return (bus->sendReceiveList(commands, count));
+}
+
+/*!
+* Queues the commands like submit, so they run after the queued requests
+*/
+SPICQueue::Error_t SPICQueue::sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context)
+{
+	Request_t request = { commands, count };
+	return (submit(request, callback, context));
+}
+
+bool SPICQueue::isBusy()
+{
+	return (pending() != 0);
+}
+
+SPICQueue::Error_t SPICQueue::submit(const Request_t &request, Callback_t callback, void *context)
+{
+	uint8_t next = head;
+	if ((uint8_t) (next - __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) >= TLE5012_SPIC_QUEUE_DEPTH)
+	{
+		rejected++;
+		return INTF_ERROR;
+	}
+	Entry_t &entry = entries[next & QUEUE_MASK];
+	entry.request = request;
+	entry.callback = callback;
+	entry.context = context;
+	__atomic_store_n(&head, (uint8_t) (next + 1), __ATOMIC_RELEASE);
+	submitted++;
+	pump();
+	return OK;
+}
+
+uint8_t SPICQueue::pending()
+{
+	return ((uint8_t) (__atomic_load_n(&head, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail, __ATOMIC_ACQUIRE)));
+}
+
+void SPICQueue::flush()
+{
+	while (pending() != 0)
+	{
+	}
+}
+
+/*!
+* Only one context starts requests at a time. On a blocking bus the completion
+* runs inside sendReceiveAsync and the loop goes on with the next request, on an
+* asynchronous bus the completion calls pump again. A completion which comes
+* while another context is in here leaves the start to it, so the queue is
+* checked again after pumping is released.
+*/
+void SPICQueue::pump()
+{
+	do
+	{
+		if (__atomic_exchange_n(&pumping, 1, __ATOMIC_ACQ_REL) != 0)
+		{
+			return;
+		}
+		while ((__atomic_load_n(&running, __ATOMIC_ACQUIRE) == 0)
+			&& (__atomic_load_n(&tail, __ATOMIC_ACQUIRE) != __atomic_load_n(&head, __ATOMIC_ACQUIRE)))
+		{
+			Entry_t &entry = entries[tail & QUEUE_MASK];
+			__atomic_store_n(&running, 1, __ATOMIC_RELEASE);
+			// a bus which ran the request at once has called done already
+			if ((bus->sendReceiveAsync(entry.request.commands, entry.request.count, done, this) != OK)
+				&& (__atomic_load_n(&running, __ATOMIC_ACQUIRE) != 0))
+			{
+				done(INTF_ERROR, this);
+			}
+		}
+		__atomic_store_n(&pumping, 0, __ATOMIC_RELEASE);
+	} while ((__atomic_load_n(&running, __ATOMIC_ACQUIRE) == 0)
+		&& (__atomic_load_n(&tail, __ATOMIC_ACQUIRE) != __atomic_load_n(&head, __ATOMIC_ACQUIRE)));
+}
+
+void SPICQueue::done(Error_t status, void *context)
+{
+	SPICQueue *queue = (SPICQueue *) context;
+	Entry_t entry = queue->entries[queue->tail & QUEUE_MASK];
+	__atomic_store_n(&queue->tail, (uint8_t) (queue->tail + 1), __ATOMIC_RELEASE);
+	__atomic_store_n(&queue->running, 0, __ATOMIC_RELEASE);
+	if (entry.callback != NULL)
+	{
+		entry.callback(status, entry.context);
+	}
+	queue->pump();
+}
+
+#endif /** TLE5012_SPIC_ASYNC **/
@@ -0,0 +1,121 @@
+/**
+ * @file        spic-queue.hpp
+ * @brief       Request queue for asynchronous transfers of the SPI cover
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef SPIC_QUEUE_HPP_
+#define SPIC_QUEUE_HPP_
+
+#include "../config/tle5012-conf.hpp"
+
+#if (TLE5012_SPIC_ASYNC == 1)
+
+#include "spic.hpp"
+
+/**
+ * @addtogroup pal
+ * @{
+ */
+
+/**
+ * @brief SPIC which queues asynchronous requests for another SPIC
+ *
+ * Put it between the sensor and its bus with sensor.sBus = &queue. submit
+ * puts a request into a ring of TLE5012_SPIC_QUEUE_DEPTH entries and returns,
+ * the requests run one after the other with SPIC::sendReceiveAsync of the
+ * bus and the callback of each is called when it is done. On a blocking bus
+ * the default sendReceiveAsync runs the request right away, so the queue
+ * also adapts all existing platforms. submit is called from one context, the
+ * completions may come from an interrupt or a worker thread, both sides only
+ * share the ring indexes and the running flags, which use the GCC __atomic
+ * builtins. The blocking calls wait until the queue is empty and go directly
+ * to the bus, so the callbacks must not use them.
+ */
+class SPICQueue: virtual public SPIC
+{
+	public:
+
+		/**
+		 * @brief Request of a command list, see SPIC::Command_t
+		 */
+		struct Request_t
+		{
+			Command_t  *commands;    /**< commands, must stay valid until the callback */
+			uint8_t     count;       /**< number of commands */
+		};
+
+		uint32_t    submitted;       //!< \brief requests taken by submit
+		uint32_t    rejected;        //!< \brief requests rejected by a full queue
+
+				SPICQueue(SPIC *bus);
+		Error_t init();
+		Error_t deinit();
+		Error_t triggerUpdate();
+		Error_t triggerUpdateBegin();
+		Error_t triggerUpdateEnd();
+		Error_t sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc);
+		Error_t sendReceiveList(Command_t *commands, uint8_t count);
+		Error_t sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context);
+		bool    isBusy();
+
+		/**
+		 * @brief Queues a request and starts it if the bus is free
+		 * @param[in]   request     commands of the request
+		 * @param[in]   callback    called with the SPIC error code when the request is done, or NULL
+		 * @param[in]   context     passed to the callback
+		 * @return      SPIC error code
+		 * @retval      OK if queued
+		 * @retval      INTF_ERROR if the queue is full
+		 */
+		Error_t     submit(const Request_t &request, Callback_t callback, void *context = NULL);
+
+		/**
+		 * @brief Number of queued requests, including the running one
+		 * @return      requests not done yet
+		 */
+		uint8_t     pending();
+
+		/**
+		 * @brief Waits until all queued requests are done
+		 */
+		void        flush();
+
+	private:
+
+		/**
+		 * @brief Queued request with its callback
+		 */
+		struct Entry_t
+		{
+			Request_t   request;
+			Callback_t  callback;
+			void       *context;
+		};
+
+		SPIC       *bus;
+		Entry_t     entries[TLE5012_SPIC_QUEUE_DEPTH];
+		uint8_t     head;            //!< \brief next free entry, written by submit only
+		uint8_t     tail;            //!< \brief running or next entry, written by the completion only
+		uint8_t     running;         //!< \brief the entry at tail is on the bus
+		uint8_t     pumping;         //!< \brief a context is starting requests
+
+		/**
+		 * @brief Starts the next queued requests, from submit and from the completions
+		 */
+		void        pump();
+
+		/**
+		 * @brief Completion of the running request
+		 */
+		static void done(Error_t status, void *context);
+};
+
+/** @} */
+
+#endif /** TLE5012_SPIC_ASYNC **/
+#endif /** SPIC_QUEUE_HPP_ **/
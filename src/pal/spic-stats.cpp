@@ -0,0 +1,316 @@
+/**
+ * @file        spic-stats.cpp
+ * @brief       Bus instrumentation for the SPI cover
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "spic-stats.hpp"
+
+#if (TLE5012_SPIC_STATS == 1)
+
+#include <string.h>
+
+/**
+ * @brief Constructor of the SPIC instrumentation
+ *
+ * @param bus      SPIC which does the transfers
+ * @param timer    Timer for the transfer times or NULL
+ */
+SPICStats::SPICStats(SPIC *bus, Timer *timer)
+{
+	this->bus = bus;
+	this->timer = timer;
+	asyncCommands = NULL;
+	asyncCount = 0;
+	asyncStart = 0;
+	asyncCallback = NULL;
+	asyncContext = NULL;
+	reset();
+}
+
+/**
+ * @brief Initializes the SPIC and starts the timer
+ *
+ * @return      SPICStats::Error_t
+ */
+SPICStats::Error_t SPICStats::init()
+{
+	if (timer != NULL)
+	{
+		timer->start();
+	}
+	return (bus->init());
+}
+
+/**
+ * @brief Deinitializes the SPIC
+ *
+ * @return      SPICStats::Error_t
+ */
+SPICStats::Error_t SPICStats::deinit()
+{
+	return (bus->deinit());
+}
+
+SPICStats::Error_t SPICStats::triggerUpdate()
+{
+	uint32_t start = now();
+	Error_t err = bus->triggerUpdate();
+	count(updates, 0, 0, now() - start);
+	return (err);
+}
+
+/*!
+* Forwards the start of a held trigger, it is counted like triggerUpdate
+*/
+SPICStats::Error_t SPICStats::triggerUpdateBegin()
+{
+	uint32_t start = now();
+	Error_t err = bus->triggerUpdateBegin();
+	count(updates, 0, 0, now() - start);
+	return (err);
+}
+
+SPICStats::Error_t SPICStats::triggerUpdateEnd()
+{
+	return (bus->triggerUpdateEnd());
+}
+
+/*!
+* Forwards the transfer and counts it on the register of the command word.
+* Reads with one or more data words plus the safety word and writes
+* are checked like Tle5012b::checkSafety does.
+*/
+SPICStats::Error_t SPICStats::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	regStats &stats = entry(sent_data[0]);
+
+	uint32_t start = now();
+	Error_t err = bus->sendReceive(sent_data, size_of_sent_data, received_data, size_of_received_data);
+	count(stats, size_of_sent_data, size_of_received_data, now() - start);
+	checkResponse(stats, sent_data, size_of_sent_data, received_data, size_of_received_data);
+	return (err);
+}
+
+/*!
+* Forwards the transfer with the CRC of the underlying SPIC and counts it on
+* the register of the command word.
+*/
+SPICStats::Error_t SPICStats::sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc)
+{
+	regStats &stats = entry(sent_data[0]);
+
+	uint32_t start = now();
+	Error_t err = bus->sendReceiveCrc(sent_data, size_of_sent_data, received_data, size_of_received_data, crc);
+	count(stats, size_of_sent_data, size_of_received_data, now() - start);
+
+	if (size_of_received_data > 1)
+	{
+		checkSafety(stats, received_data[size_of_received_data - 1], crcFinal(crc));
+	}
+	return (err);
+}
+
+/*!
+* Forwards the list as one transaction, so the bus sets up once for all
+* commands, and counts each command on the register of its command word.
+* The time of the list is shared out on the commands by their words.
+*/
+SPICStats::Error_t SPICStats::sendReceiveList(Command_t *commands, uint8_t count)
+{
+	uint32_t start = now();
+	Error_t err = bus->sendReceiveList(commands, count);
+	countList(commands, count, now() - start);
+	return (err);
+}
+
+/*!
+* Forwards the list to the asynchronous transfer of the bus, the commands are
+* counted when the bus calls back, before the callback of the caller.
+*/
+SPICStats::Error_t SPICStats::sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context)
+{
+	if (bus->isBusy())
+	{
+		return INTF_ERROR;
+	}
+	asyncCommands = commands;
+	asyncCount = count;
+	asyncCallback = callback;
+	asyncContext = context;
+	asyncStart = now();
+	return (bus->sendReceiveAsync(commands, count, asyncDone, this));
+}
+
+bool SPICStats::isBusy()
+{
+	return (bus->isBusy());
+}
+
+/**
+ * @brief Completion of sendReceiveAsync, counts the commands and calls the
+ * callback of the caller
+ *
+ * @param status   SPIC error code of the commands
+ * @param context  the SPICStats
+ */
+void SPICStats::asyncDone(Error_t status, void *context)
+{
+	SPICStats *stats = (SPICStats *) context;
+	stats->countList(stats->asyncCommands, stats->asyncCount, stats->now() - stats->asyncStart);
+	if (stats->asyncCallback != NULL)
+	{
+		stats->asyncCallback(status, stats->asyncContext);
+	}
+}
+
+void SPICStats::reset()
+{
+	memset(regs, 0, sizeof(regs));
+	memset(&updates, 0, sizeof(updates));
+}
+
+SPICStats::regStats &SPICStats::registerStats(uint8_t address)
+{
+	return (regs[Reg::posFromAddress((uint16_t) (address & 0x3F) << 4)]);
+}
+
+void SPICStats::total(regStats &total)
+{
+	total = updates;
+	for (uint8_t i = 0; i < SPIC_STATS_ENTRIES; i++)
+	{
+		total.transfers += regs[i].transfers;
+		total.wordsSent += regs[i].wordsSent;
+		total.wordsReceived += regs[i].wordsReceived;
+		total.timeMicro += regs[i].timeMicro;
+		total.crcErrors += regs[i].crcErrors;
+		total.safetyErrors += regs[i].safetyErrors;
+		for (uint8_t b = 0; b < TLE5012_SPIC_STATS_BUCKETS; b++)
+		{
+			total.histogram[b] += regs[i].histogram[b];
+		}
+	}
+}
+
+uint32_t SPICStats::now()
+{
+	uint32_t time = 0;
+	if (timer != NULL)
+	{
+		timer->elapsedMicro(time);
+	}
+	return (time);
+}
+
+SPICStats::regStats &SPICStats::entry(uint16_t command)
+{
+	return (regs[Reg::posFromAddress(command & REG_ADDRESS_MASK)]);
+}
+
+/**
+ * @brief Counts a transfer
+ *
+ * @param stats    counters of the register
+ * @param sent     words sent
+ * @param received words received
+ * @param time     time of the transfer in us
+ */
+void SPICStats::count(regStats &stats, uint16_t sent, uint16_t received, uint32_t time)
+{
+	uint8_t bucket = 0;
+	for (uint32_t t = time; (t > 0) && (bucket < TLE5012_SPIC_STATS_BUCKETS - 1); t >>= 1)
+	{
+		bucket++;
+	}
+	stats.transfers++;
+	stats.wordsSent += sent;
+	stats.wordsReceived += received;
+	stats.timeMicro += time;
+	if (stats.histogram[bucket] != 0xFFFF)
+	{
+		stats.histogram[bucket]++;
+	}
+}
+
+/**
+ * @brief Counts the commands of a list and checks their safety words
+ *
+ * @param commands commands of the list
+ * @param length   number of commands
+ * @param time     time of the whole list in us
+ */
+void SPICStats::countList(Command_t *commands, uint8_t length, uint32_t time)
+{
+	uint32_t words = 0;
+	for (uint8_t i = 0; i < length; i++)
+	{
+		words += commands[i].sentSize + commands[i].receivedSize;
+	}
+	for (uint8_t i = 0; i < length; i++)
+	{
+		Command_t &c = commands[i];
+		regStats &stats = entry(c.sent[0]);
+		uint32_t share = (words > 0) ? (uint32_t) (((uint64_t) time * (c.sentSize + c.receivedSize)) / words) : 0;
+		count(stats, c.sentSize, c.receivedSize, share);
+		if (c.crc != NULL)
+		{
+			if (c.receivedSize > 1)
+			{
+				checkSafety(stats, c.received[c.receivedSize - 1], crcFinal(*c.crc));
+			}
+		}else{
+			checkResponse(stats, c.sent, c.sentSize, c.received, c.receivedSize);
+		}
+	}
+}
+
+/**
+ * @brief Checks the safety word of a transfer without a CRC context, reads
+ * with one or more data words plus the safety word and writes
+ *
+ * @param stats        counters of the register
+ * @param sent         sent words
+ * @param sentSize     number of sent words
+ * @param received     received words
+ * @param receivedSize number of received words
+ */
+void SPICStats::checkResponse(regStats &stats, uint16_t *sent, uint16_t sentSize, uint16_t *received, uint16_t receivedSize)
+{
+	uint16_t command = sent[0];
+	uint16_t length = command & 0x000F;
+	if (command & READ_SENSOR)
+	{
+		if ((length > 0) && (receivedSize == length + 1))
+		{
+			checkSafety(stats, received[length], crc8Words(command, received, length));
+		}
+	}else if ((sentSize > 1) && (receivedSize > 0))
+	{
+		checkSafety(stats, received[0], crc8Words(command, &sent[1], sentSize - 1));
+	}
+}
+
+/**
+ * @brief Counts a failed safety word, in the order of Tle5012b::checkSafetyCrc
+ *
+ * @param stats    counters of the register
+ * @param safety   received safety word
+ * @param crc      CRC of the command and the data words
+ */
+void SPICStats::checkSafety(regStats &stats, uint16_t safety, uint8_t crc)
+{
+	uint16_t statusOk = SYSTEM_ERROR_MASK | INTERFACE_ERROR_MASK | INV_ANGLE_ERROR_MASK;
+	if ((safety & statusOk) != statusOk)
+	{
+		stats.safetyErrors++;
+	}else if ((uint8_t) safety != crc)
+	{
+		stats.crcErrors++;
+	}
+}
+
+#endif /** TLE5012_SPIC_STATS **/
@@ -0,0 +1,113 @@
+/**
+ * @file        spic-stats.hpp
+ * @brief       Bus instrumentation for the SPI cover
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef SPIC_STATS_HPP_
+#define SPIC_STATS_HPP_
+
+#include "../config/tle5012-conf.hpp"
+
+#if (TLE5012_SPIC_STATS == 1)
+
+#include "../corelib/TLE5012b.hpp"
+#include "timer.hpp"
+
+/**
+ * @addtogroup pal
+ * @{
+ */
+
+#define SPIC_STATS_ENTRIES    (MAX_NUM_REG + 1)    /**< one entry per register and one for all other addresses */
+
+/**
+ * @brief SPIC which counts the traffic of another SPIC
+ *
+ * Put it between the sensor and its bus with sensor.sBus = &stats. Every
+ * transfer is counted on the register of its command word: words sent and
+ * received, the time from the Timer PAL in a log2 histogram and failed
+ * safety words, split into CRC failures and set STAT error bits. A command
+ * list is forwarded as one transaction and each of its commands is counted
+ * like a single transfer, an asynchronous list when the bus calls back.
+ * Only built with TLE5012_SPIC_STATS 1, so it costs nothing otherwise.
+ */
+class SPICStats: virtual public SPIC
+{
+	public:
+
+		/**
+		 * @brief Counters of one register, histogram bucket n counts the
+		 * transfers below 2^n us, the last one all longer transfers
+		 */
+		struct regStats
+		{
+			uint32_t transfers;                                 //!< \brief chip select cycles
+			uint32_t wordsSent;                                 //!< \brief command and data words sent
+			uint32_t wordsReceived;                             //!< \brief data and safety words received
+			uint32_t timeMicro;                                 //!< \brief time of all transfers in us
+			uint16_t crcErrors;                                 //!< \brief safety words with a wrong CRC
+			uint16_t safetyErrors;                              //!< \brief safety words with STAT_ERR, STAT_ACC or STAT_ANG
+			uint16_t histogram[TLE5012_SPIC_STATS_BUCKETS];     //!< \brief transfer times, saturating
+		};
+
+		regStats regs[SPIC_STATS_ENTRIES];   //!< \brief counters by register position, see Reg::posFromAddress
+		regStats updates;                    //!< \brief counters of triggerUpdate
+
+				SPICStats(SPIC *bus, Timer *timer = NULL);
+		Error_t init();
+		Error_t deinit();
+		Error_t triggerUpdate();
+		Error_t triggerUpdateBegin();
+		Error_t triggerUpdateEnd();
+		Error_t sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc);
+		Error_t sendReceiveList(Command_t *commands, uint8_t count);
+		Error_t sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context);
+		bool    isBusy();
+
+		/**
+		 * @brief Clears all counters
+		 */
+		void        reset();
+
+		/**
+		 * @brief Counters of a register
+		 * @param[in]   address 6 bit register address
+		 * @return      counters of the register, or of all other addresses
+		 */
+		regStats   &registerStats(uint8_t address);
+
+		/**
+		 * @brief Sums the counters of all registers and of triggerUpdate
+		 * @param[out]  total   summed counters
+		 */
+		void        total(regStats &total);
+
+	private:
+
+		SPIC       *bus;
+		Timer      *timer;
+		Command_t  *asyncCommands;   //!< \brief commands of the running sendReceiveAsync
+		uint8_t     asyncCount;
+		uint32_t    asyncStart;      //!< \brief timer value at the start of the running sendReceiveAsync
+		Callback_t  asyncCallback;
+		void       *asyncContext;
+
+		static void asyncDone(Error_t status, void *context);
+
+		uint32_t    now();
+		regStats   &entry(uint16_t command);
+		void        count(regStats &stats, uint16_t sent, uint16_t received, uint32_t time);
+		void        countList(Command_t *commands, uint8_t length, uint32_t time);
+		void        checkResponse(regStats &stats, uint16_t *sent, uint16_t sentSize, uint16_t *received, uint16_t receivedSize);
+		void        checkSafety(regStats &stats, uint16_t safety, uint8_t crc);
+};
+
+/** @} */
+
+#endif /** TLE5012_SPIC_STATS **/
+#endif /** SPIC_STATS_HPP_ **/
@@ -0,0 +1,346 @@
+/**
+ * @file        spic-trace.cpp
+ * @brief       Trace recorder and replay for the SPI cover
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "spic-trace.hpp"
+
+#if (TLE5012_SPIC_TRACE == 1)
+
+#include <string.h>
+
+#define SPIC_TRACE_CHUNK_WORDS    16    /**< words passed to the sink at once */
+
+/**
+ * @brief Constructor of the trace recorder
+ *
+ * @param bus      SPIC which does the transfers
+ * @param cs       chip select identity written to the records
+ * @param sink     receives the trace bytes
+ * @param context  passed to the sink
+ * @param timer    Timer for the timestamps or NULL for 0
+ */
+SPICTrace::SPICTrace(SPIC *bus, uint8_t cs, spicTraceSink_t sink, void *context, Timer *timer)
+{
+	this->bus = bus;
+	this->cs = cs;
+	this->sink = sink;
+	this->context = context;
+	this->timer = timer;
+	asyncCommands = NULL;
+	asyncCount = 0;
+	asyncCallback = NULL;
+	asyncContext = NULL;
+}
+
+/**
+ * @brief Initializes the SPIC and starts the timer
+ *
+ * @return      SPICTrace::Error_t
+ */
+SPICTrace::Error_t SPICTrace::init()
+{
+	if (timer != NULL)
+	{
+		timer->start();
+	}
+	return (bus->init());
+}
+
+/**
+ * @brief Deinitializes the SPIC
+ *
+ * @return      SPICTrace::Error_t
+ */
+SPICTrace::Error_t SPICTrace::deinit()
+{
+	return (bus->deinit());
+}
+
+SPICTrace::Error_t SPICTrace::triggerUpdate()
+{
+	Error_t err = bus->triggerUpdate();
+	record(SPIC_TRACE_UPDATE, NULL, 0, NULL, 0);
+	return (err);
+}
+
+/*!
+* Forwards the start of a held trigger, the trace has the same record as
+* for triggerUpdate
+*/
+SPICTrace::Error_t SPICTrace::triggerUpdateBegin()
+{
+	Error_t err = bus->triggerUpdateBegin();
+	record(SPIC_TRACE_UPDATE, NULL, 0, NULL, 0);
+	return (err);
+}
+
+SPICTrace::Error_t SPICTrace::triggerUpdateEnd()
+{
+	return (bus->triggerUpdateEnd());
+}
+
+SPICTrace::Error_t SPICTrace::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	Error_t err = bus->sendReceive(sent_data, size_of_sent_data, received_data, size_of_received_data);
+	record(SPIC_TRACE_TRANSFER, sent_data, size_of_sent_data, received_data, size_of_received_data);
+	return (err);
+}
+
+/*!
+* Keeps the CRC calculation of the underlying SPIC, the trace has the same
+* record as for sendReceive.
+*/
+SPICTrace::Error_t SPICTrace::sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc)
+{
+	Error_t err = bus->sendReceiveCrc(sent_data, size_of_sent_data, received_data, size_of_received_data, crc);
+	record(SPIC_TRACE_TRANSFER, sent_data, size_of_sent_data, received_data, size_of_received_data);
+	return (err);
+}
+
+/*!
+* Forwards the list as one transaction and records each command like a
+* sendReceive, so the replay runs the list command by command.
+*/
+SPICTrace::Error_t SPICTrace::sendReceiveList(Command_t *commands, uint8_t count)
+{
+	Error_t err = bus->sendReceiveList(commands, count);
+	for (uint8_t i = 0; i < count; i++)
+	{
+		record(SPIC_TRACE_TRANSFER, commands[i].sent, commands[i].sentSize, commands[i].received, commands[i].receivedSize);
+	}
+	return (err);
+}
+
+/*!
+* Forwards the list to the asynchronous transfer of the bus, the commands are
+* recorded when the bus calls back, before the callback of the caller. The
+* sink then runs in the context of the completion, e.g. an interrupt.
+*/
+SPICTrace::Error_t SPICTrace::sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context)
+{
+	if (bus->isBusy())
+	{
+		return INTF_ERROR;
+	}
+	asyncCommands = commands;
+	asyncCount = count;
+	asyncCallback = callback;
+	asyncContext = context;
+	return (bus->sendReceiveAsync(commands, count, asyncDone, this));
+}
+
+bool SPICTrace::isBusy()
+{
+	return (bus->isBusy());
+}
+
+/**
+ * @brief Completion of sendReceiveAsync, records the commands and calls the
+ * callback of the caller
+ *
+ * @param status   SPIC error code of the commands
+ * @param context  the SPICTrace
+ */
+void SPICTrace::asyncDone(Error_t status, void *context)
+{
+	SPICTrace *trace = (SPICTrace *) context;
+	for (uint8_t i = 0; i < trace->asyncCount; i++)
+	{
+		Command_t &c = trace->asyncCommands[i];
+		trace->record(SPIC_TRACE_TRANSFER, c.sent, c.sentSize, c.received, c.receivedSize);
+	}
+	if (trace->asyncCallback != NULL)
+	{
+		trace->asyncCallback(status, trace->asyncContext);
+	}
+}
+
+void SPICTrace::writeHeader()
+{
+	uint8_t header[SPIC_TRACE_HEADER_SIZE];
+	memcpy(header, SPIC_TRACE_MAGIC, 4);
+	header[4] = SPIC_TRACE_VERSION;
+	header[5] = 0;
+	sink(header, SPIC_TRACE_HEADER_SIZE, context);
+}
+
+/**
+ * @brief Passes one record to the sink
+ *
+ * @param type             record type
+ * @param sent             sent words
+ * @param sentLength       number of sent words
+ * @param received         received words
+ * @param receivedLength   number of received words
+ */
+void SPICTrace::record(uint8_t type, uint16_t *sent, uint16_t sentLength, uint16_t *received, uint16_t receivedLength)
+{
+	uint8_t bytes[2 * SPIC_TRACE_CHUNK_WORDS];
+	uint32_t time = 0;
+	if (timer != NULL)
+	{
+		timer->elapsedMicro(time);
+	}
+	bytes[0] = type;
+	bytes[1] = cs;
+	bytes[2] = (uint8_t) time;
+	bytes[3] = (uint8_t) (time >> 8);
+	bytes[4] = (uint8_t) (time >> 16);
+	bytes[5] = (uint8_t) (time >> 24);
+	bytes[6] = (uint8_t) sentLength;
+	bytes[7] = (uint8_t) receivedLength;
+	sink(bytes, SPIC_TRACE_RECORD_SIZE, context);
+
+	for (uint8_t part = 0; part < 2; part++)
+	{
+		uint16_t *words = (part == 0) ? sent : received;
+		uint16_t length = (part == 0) ? sentLength : receivedLength;
+		for (uint16_t i = 0; i < length; i += SPIC_TRACE_CHUNK_WORDS)
+		{
+			uint16_t chunk = ((length - i) < SPIC_TRACE_CHUNK_WORDS) ? (length - i) : SPIC_TRACE_CHUNK_WORDS;
+			for (uint16_t j = 0; j < chunk; j++)
+			{
+				bytes[2 * j] = (uint8_t) words[i + j];
+				bytes[(2 * j) + 1] = (uint8_t) (words[i + j] >> 8);
+			}
+			sink(bytes, 2 * chunk, context);
+		}
+	}
+}
+
+/**
+ * @brief Constructor of the trace replay
+ *
+ * @param trace    recorded trace, including the header
+ * @param length   trace length in bytes
+ * @param cs       chip select identity of the replayed records
+ */
+SPICReplay::SPICReplay(const uint8_t *trace, uint32_t length, uint8_t cs)
+{
+	this->trace = trace;
+	this->length = length;
+	this->cs = cs;
+	rewind();
+}
+
+/**
+ * @brief Initializes the SPIC
+ *
+ * @return      CONF_ERROR if the trace header is missing or of another version
+ */
+SPICReplay::Error_t SPICReplay::init()
+{
+	return (rewind());
+}
+
+/**
+ * @brief Deinitializes the SPIC
+ *
+ * @return      SPICReplay::Error_t
+ */
+SPICReplay::Error_t SPICReplay::deinit()
+{
+	return OK;
+}
+
+SPICReplay::Error_t SPICReplay::triggerUpdate()
+{
+	return (next(SPIC_TRACE_UPDATE, NULL, 0, NULL, 0) ? OK : READ_ERROR);
+}
+
+SPICReplay::Error_t SPICReplay::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	return (next(SPIC_TRACE_TRANSFER, sent_data, size_of_sent_data, received_data, size_of_received_data) ? OK : READ_ERROR);
+}
+
+SPICReplay::Error_t SPICReplay::rewind()
+{
+	transfers = 0;
+	mismatches = 0;
+	overruns = 0;
+	lastTime = 0;
+	position = SPIC_TRACE_HEADER_SIZE;
+	if ((length < SPIC_TRACE_HEADER_SIZE) || (memcmp(trace, SPIC_TRACE_MAGIC, 4) != 0) || (trace[4] != SPIC_TRACE_VERSION))
+	{
+		position = length;
+		return CONF_ERROR;
+	}
+	return OK;
+}
+
+uint32_t SPICReplay::timestamp()
+{
+	return (lastTime);
+}
+
+uint16_t SPICReplay::word(uint32_t offset)
+{
+	return ((uint16_t) (trace[offset] | (trace[offset + 1] << 8)));
+}
+
+/**
+ * @brief Replays the next record of the chip select identity
+ *
+ * @param type             expected record type
+ * @param sent             sent words to compare
+ * @param sentLength       number of sent words
+ * @param received         buffer for the received words
+ * @param receivedLength   number of words to receive
+ * @return                 false after the end of the trace
+ */
+bool SPICReplay::next(uint8_t type, uint16_t *sent, uint16_t sentLength, uint16_t *received, uint16_t receivedLength)
+{
+	transfers++;
+	// skip the records of the other chip selects
+	while ((position + SPIC_TRACE_RECORD_SIZE <= length) && (trace[position + 1] != cs))
+	{
+		position += SPIC_TRACE_RECORD_SIZE + 2 * (trace[position + 6] + trace[position + 7]);
+	}
+	if (position + SPIC_TRACE_RECORD_SIZE > length)
+	{
+		overruns++;
+		for (uint16_t i = 0; i < receivedLength; i++)
+		{
+			received[i] = 0;
+		}
+		return (false);
+	}
+
+	const uint8_t *rec = &trace[position];
+	uint16_t recSent = rec[6];
+	uint16_t recReceived = rec[7];
+	uint32_t words = position + SPIC_TRACE_RECORD_SIZE;
+	lastTime = (uint32_t) rec[2] | ((uint32_t) rec[3] << 8) | ((uint32_t) rec[4] << 16) | ((uint32_t) rec[5] << 24);
+	position = words + 2 * (recSent + recReceived);
+	if (position > length)
+	{
+		overruns++;
+		for (uint16_t i = 0; i < receivedLength; i++)
+		{
+			received[i] = 0;
+		}
+		return (false);
+	}
+
+	bool match = (rec[0] == type) && (recSent == sentLength) && (recReceived == receivedLength);
+	for (uint16_t i = 0; match && (i < sentLength); i++)
+	{
+		match = (word(words + 2 * i) == sent[i]);
+	}
+	if (!match)
+	{
+		mismatches++;
+	}
+	for (uint16_t i = 0; i < receivedLength; i++)
+	{
+		received[i] = (i < recReceived) ? word(words + 2 * (recSent + i)) : 0;
+	}
+	return (true);
+}
+
+#endif /** TLE5012_SPIC_TRACE **/
@@ -0,0 +1,147 @@
+/**
+ * @file        spic-trace.hpp
+ * @brief       Trace recorder and replay for the SPI cover
+ * @date        October 2026
+ * @copyright   Copyright (c) 2019-2026 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef SPIC_TRACE_HPP_
+#define SPIC_TRACE_HPP_
+
+#include "../config/tle5012-conf.hpp"
+
+#if (TLE5012_SPIC_TRACE == 1)
+
+#include "spic.hpp"
+#include "timer.hpp"
+
+/**
+ * @addtogroup pal
+ * @{
+ */
+
+/**
+ * @brief Trace format, all values little endian
+ *
+ * The trace starts with the header "T512", the format version and one
+ * reserved byte. Each record has a type byte, the chip select identity,
+ * the timestamp in us as uint32, the number of sent and of received
+ * words as one byte each and then the sent and the received words.
+ */
+#define SPIC_TRACE_MAGIC          "T512"    /**< trace header */
+#define SPIC_TRACE_VERSION        1         /**< trace format version */
+#define SPIC_TRACE_HEADER_SIZE    6         /**< magic, version and reserved byte */
+#define SPIC_TRACE_RECORD_SIZE    8         /**< record size without the words */
+
+/**
+ * @brief Record types
+ */
+enum spicTraceType_t
+{
+	SPIC_TRACE_TRANSFER = 0x01,    //!< \brief sendReceive, sendReceiveCrc or one command of sendReceiveList
+	SPIC_TRACE_UPDATE   = 0x02     //!< \brief triggerUpdate or triggerUpdateBegin
+};
+
+/**
+ * @brief Receives the trace bytes, e.g. to write them to a file or a buffer
+ */
+typedef void (*spicTraceSink_t)(const uint8_t *data, uint16_t length, void *context);
+
+/**
+ * @brief SPIC which records all transfers of another SPIC
+ *
+ * Put it between the sensor and its bus with sensor.sBus = &trace. Several
+ * recorders with different chip select identities can share one sink, so
+ * the trace of all sensors on a bus keeps the order of the transfers. A
+ * command list is recorded as one transfer per command, an asynchronous
+ * list when the bus calls back.
+ */
+class SPICTrace: virtual public SPIC
+{
+	public:
+
+				SPICTrace(SPIC *bus, uint8_t cs, spicTraceSink_t sink, void *context, Timer *timer = NULL);
+		Error_t init();
+		Error_t deinit();
+		Error_t triggerUpdate();
+		Error_t triggerUpdateBegin();
+		Error_t triggerUpdateEnd();
+		Error_t sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc);
+		Error_t sendReceiveList(Command_t *commands, uint8_t count);
+		Error_t sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context);
+		bool    isBusy();
+
+		/**
+		 * @brief Writes the trace header to the sink, once per trace
+		 */
+		void        writeHeader();
+
+	private:
+
+		SPIC           *bus;
+		Timer          *timer;
+		spicTraceSink_t sink;
+		void           *context;
+		uint8_t         cs;
+		Command_t      *asyncCommands;   //!< \brief commands of the running sendReceiveAsync
+		uint8_t         asyncCount;
+		Callback_t      asyncCallback;
+		void           *asyncContext;
+
+		static void asyncDone(Error_t status, void *context);
+		void        record(uint8_t type, uint16_t *sent, uint16_t sentLength, uint16_t *received, uint16_t receivedLength);
+};
+
+/**
+ * @brief SPIC which answers from a recorded trace
+ *
+ * Takes the records of one chip select identity in order and returns
+ * their received words. The sent words are compared with the record, so
+ * a driver which talks differently to the sensor than the recorded one is
+ * found by mismatches. Transfers after the end of the trace receive 0.
+ */
+class SPICReplay: virtual public SPIC
+{
+	public:
+
+		uint32_t    transfers;       //!< \brief transfers replayed
+		uint32_t    mismatches;      //!< \brief transfers which sent other words or another type than recorded
+		uint32_t    overruns;        //!< \brief transfers after the end of the trace
+
+				SPICReplay(const uint8_t *trace, uint32_t length, uint8_t cs);
+		Error_t init();
+		Error_t deinit();
+		Error_t triggerUpdate();
+		Error_t sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+
+		/**
+		 * @brief Starts the replay again at the first record and clears the counters
+		 * @return      CONF_ERROR if the trace header is missing or of another version
+		 */
+		Error_t     rewind();
+
+		/**
+		 * @brief Timestamp of the last replayed record
+		 * @return      time in us
+		 */
+		uint32_t    timestamp();
+
+	private:
+
+		const uint8_t *trace;
+		uint32_t    length;
+		uint32_t    position;
+		uint32_t    lastTime;
+		uint8_t     cs;
+
+		bool        next(uint8_t type, uint16_t *sent, uint16_t sentLength, uint16_t *received, uint16_t receivedLength);
+		uint16_t    word(uint32_t offset);
+};
+
+/** @} */
+
+#endif /** TLE5012_SPIC_TRACE **/
+#endif /** SPIC_TRACE_HPP_ **/
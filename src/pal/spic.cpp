@@ -8,9 +8,51 @@
  */
 
 #include "spic.hpp"
+#include "../corelib/tle5012b_crc.hpp"
 
 
 SPIC::Error_t SPIC::checkErrorStatus()
 {
 	return errorStatus;
-}
\ No newline at end of file
+}
+
+SPIC::Error_t SPIC::sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc)
+{
+	Error_t err = sendReceive(sent_data, size_of_sent_data, received_data, size_of_received_data);
+	crcInit(crc, sent_data[0]);
+	for (uint16_t i = 0; i + 1 < size_of_received_data; i++)
+	{
+		crcUpdateWord(crc, received_data[i]);
+	}
+	return err;
+}
+
+SPIC::Error_t SPIC::sendReceiveList(Command_t *commands, uint8_t count)
+{
+	Error_t err = OK;
+	for (uint8_t i = 0; (i < count) && (err == OK); i++)
+	{
+		if (commands[i].crc != NULL)
+		{
+			err = sendReceiveCrc(commands[i].sent, commands[i].sentSize, commands[i].received, commands[i].receivedSize, *commands[i].crc);
+		}else{
+			err = sendReceive(commands[i].sent, commands[i].sentSize, commands[i].received, commands[i].receivedSize);
+		}
+	}
+	return err;
+}
+
+SPIC::Error_t SPIC::sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context)
+{
+	Error_t err = sendReceiveList(commands, count);
+	if (callback != NULL)
+	{
+		callback(err, context);
+	}
+	return err;
+}
+
+bool SPIC::isBusy()
+{
+	return false;
+}
@@ -8,10 +8,13 @@
  */
 
 #include <stdint.h>
+#include <stddef.h>
 
 #ifndef SPIC_HPP_
 #define SPIC_HPP_
 
+#include "crc8-ctx.hpp"
+
 /**
  * @addtogroup pal
  * @{
@@ -30,6 +33,24 @@ class SPIC
 			WRITE_ERROR = -4,    /**< Write error */
 		};
 
+		/**
+		 * @brief One command of a command list, the command word with the data word
+		 * of a write and the words of its response
+		 */
+		struct Command_t
+		{
+			uint16_t  *sent;             /**< command word and the data word of a write */
+			uint16_t   sentSize;         /**< words to send, 1 for a read, 2 for a write */
+			uint16_t  *received;         /**< buffer for the data words and the safety word */
+			uint16_t   receivedSize;     /**< words to receive, including the safety word */
+			crc8Ctx_t *crc;              /**< safety word CRC context as of sendReceiveCrc, or NULL */
+		};
+
+		/**
+		 * @brief Completion callback of sendReceiveAsync, may run in interrupt context
+		 */
+		typedef void (*Callback_t)(Error_t status, void *context);
+
 		/**
 		 * @brief       Initializes the SPIC
 		 * @return      SPIC error code
@@ -54,6 +75,31 @@ class SPIC
 		 */
 		virtual Error_t       triggerUpdate() = 0;
 
+		/**
+		 * @brief       Starts a trigger and holds it, e.g. CSQ low with SCK low
+		 *
+		 * With triggerUpdateEnd the triggers of several sensors on one bus can
+		 * overlap, so their update buffers take the same instant. The default
+		 * sends the whole trigger with triggerUpdate.
+		 *
+		 * @return      SPIC error code
+		 * @retval      OK if success
+		 */
+		virtual Error_t       triggerUpdateBegin()
+		{
+			return triggerUpdate();
+		}
+
+		/**
+		 * @brief       Ends a trigger started with triggerUpdateBegin
+		 * @return      SPIC error code
+		 * @retval      OK if success
+		 */
+		virtual Error_t       triggerUpdateEnd()
+		{
+			return OK;
+		}
+
 		/**
 		 * @brief           Function which allows 3wire SPI (SSC) by sending and receiving data in the same function
 		 * 
@@ -67,6 +113,70 @@ class SPIC
 		 */
 		virtual Error_t       sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data) = 0;
 
+		/**
+		 * @brief           Same as sendReceive, but also calculates the safety word CRC of a read
+		 *
+		 * The CRC context is started with the command word and all received data words
+		 * except the last one, the safety word, are folded in. Platforms override this
+		 * to fold each word in while the next one is received, the default folds them
+		 * in after the transfer.
+		 *
+		 * @param sent_data              pointer to the command word
+		 * @param size_of_sent_data      the size of the command word, 1
+		 * @param received_data          pointer to data structure buffer for the read data
+		 * @param size_of_received_data  size of data words to be read, including the safety word
+		 * @param crc                    CRC context of the command and the received data words
+		 * @return                       SPIC error code
+		 * @retval                       OK if success
+		 * @retval                       INIT_ERROR if transfer fails
+		 */
+		virtual Error_t       sendReceiveCrc(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data, crc8Ctx_t &crc);
+
+		/**
+		 * @brief           Runs a list of commands as one bus transaction
+		 *
+		 * Each command is sent and its response received like with sendReceive, or
+		 * sendReceiveCrc if the command has a CRC context. The sensor ends every
+		 * command with the chip select, so the chip select is pulsed between the
+		 * commands, but platforms override this to set up the bus and the pins once
+		 * for the whole list and to change only the data line direction per command.
+		 * The default runs the commands one by one.
+		 *
+		 * @param commands               commands in the order of the transfers
+		 * @param count                  number of commands
+		 * @return                       SPIC error code of the first failed command
+		 * @retval                       OK if success
+		 * @retval                       INIT_ERROR if transfer fails
+		 */
+		virtual Error_t       sendReceiveList(Command_t *commands, uint8_t count);
+
+		/**
+		 * @brief           Starts a list of commands and returns before they are done
+		 *
+		 * Platforms with a transfer engine, e.g. the USIC FIFOs of the XMC, run the
+		 * commands in the background and call the callback when the last response
+		 * is received. The commands, their words and CRC contexts must stay valid
+		 * until then, and no other transfer may use the bus before. The default
+		 * runs sendReceiveList, calls the callback before it returns and returns
+		 * the error code of the commands as well, so the blocking platforms work
+		 * unchanged.
+		 *
+		 * @param commands               commands in the order of the transfers
+		 * @param count                  number of commands
+		 * @param callback               called with the SPIC error code when all commands are done, or NULL
+		 * @param context                passed to the callback
+		 * @return                       SPIC error code of the start, or of the commands if they are done
+		 * @retval                       OK if the commands are started or done
+		 * @retval                       INTF_ERROR if a transfer is still running
+		 */
+		virtual Error_t       sendReceiveAsync(Command_t *commands, uint8_t count, Callback_t callback, void *context);
+
+		/**
+		 * @brief           Checks for a running sendReceiveAsync
+		 * @return          true until the callback of the running transfer is called
+		 */
+		virtual bool          isBusy();
+
 		Error_t checkErrorStatus();
 
 	private:
@@ -60,6 +60,24 @@ class Timer
 		 */
 		virtual  Error_t         elapsed (uint32_t &elapsed) = 0;
 
+		/**
+		 * @brief       Elapsed time since the timer was started in microseconds
+		 *
+		 * Platforms with a microsecond clock override this, the default
+		 * has the millisecond resolution of elapsed().
+		 *
+		 * @param[out]  elapsed Time in microseconds
+		 * @return      Timer error code
+		 * @retval      OK if success
+		 * @retval      INIT_ERROR if hardware interface error
+		 */
+		virtual  Error_t         elapsedMicro (uint32_t &elapsed)
+		{
+			Error_t err = this->elapsed(elapsed);
+			elapsed *= 1000;
+			return err;
+		}
+
 		/**
 		 * @brief       Stops the timer
 		 * @return      Timer error code